@@ -0,0 +1,49 @@
+#include "arena.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+Arena::Arena(const size_t block_size) : block_size_(block_size) {}
+
+Arena::~Arena() {
+  reset();
+}
+
+void* Arena::allocate(const size_t size, const size_t align) {
+  // 从当前块开始找能放下的块，放不下时新开一块
+  while (current_ < blocks_.size()) {
+    Block& block = blocks_[current_];
+    const auto base = reinterpret_cast<uintptr_t>(block.data.get());
+    const size_t start = ((base + offset_ + align - 1) & ~(uintptr_t(align) - 1)) - base;
+    if (start + size <= block.size) {
+      offset_ = start + size;
+      return block.data.get() + start;
+    }
+    current_++;
+    offset_ = 0;
+  }
+
+  const size_t block_size = std::max(block_size_, size + align);
+  blocks_.push_back({ std::unique_ptr<char[]>(new char[block_size]), block_size });
+  current_ = blocks_.size() - 1;
+  offset_ = 0;
+  return allocate(size, align);
+}
+
+void Arena::reset() {
+  for (auto it = destructors_.rbegin(); it != destructors_.rend(); ++it) {
+    it->destroy(it->object);
+  }
+  destructors_.clear();
+  objects_ = 0;
+  current_ = 0;
+  offset_ = 0;
+}
+
+size_t Arena::capacity() const {
+  size_t total = 0;
+  for (const auto& block : blocks_) {
+    total += block.size;
+  }
+  return total;
+}
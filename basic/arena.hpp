@@ -0,0 +1,66 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// 顺序分配的内存池：对象按块连续分配，不单独释放，reset() 时统一析构
+// reset() 保留已分配的块，下次分析直接复用；不可复制
+class Arena {
+public:
+  // block_size 为每块的字节数，超过块大小的对象单独占一块
+  explicit Arena(size_t block_size = 64 * 1024);
+
+  ~Arena();
+
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+
+  // 在池中构造对象，有非平凡析构函数的对象登记后由 reset() 析构
+  template <class T, class... Args>
+  T* make(Args&&... args) {
+    T* object = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      destructors_.push_back({ object, [](void* p) { static_cast<T*>(p)->~T(); } });
+    }
+    objects_++;
+    return object;
+  }
+
+  // 分配 size 字节，按 align 对齐
+  void* allocate(size_t size, size_t align);
+
+  // 逆序析构所有对象，已分配的块留作复用
+  void reset();
+
+  // 自上次 reset() 以来构造的对象数
+  size_t objects() const { return objects_; }
+
+  // 已分配的块数和总字节数
+  size_t blocks() const { return blocks_.size(); }
+  size_t capacity() const;
+
+private:
+  struct Block {
+    std::unique_ptr<char[]> data;
+    size_t size;
+  };
+
+  struct Destructor {
+    void* object;
+    void (*destroy)(void*);
+  };
+
+  size_t block_size_;
+  std::vector<Block> blocks_;
+  size_t current_ = 0; // 当前使用的块
+  size_t offset_ = 0;  // 当前块已用字节
+  std::vector<Destructor> destructors_;
+  size_t objects_ = 0;
+};
+
+#endif // ARENA_HPP
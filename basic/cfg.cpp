@@ -0,0 +1,236 @@
+#include "cfg.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+ControlFlowGraph::ControlFlowGraph(const TacCode& code) : code_(&code) {
+  build_blocks();
+  build_dominators();
+  build_loops();
+}
+
+void ControlFlowGraph::build_blocks() {
+  const TacCode& code = *code_;
+  std::unordered_map<std::string, size_t> label_block;
+  bool leader = true;
+  for (size_t i = 0; i < code.size(); ++i) {
+    const TacInstruction& instruction = code[i];
+    if (leader || instruction.op == TacOp::LABEL) {
+      if (!blocks_.empty()) blocks_.back().end = i;
+      blocks_.emplace_back();
+      blocks_.back().begin = i;
+    }
+    if (instruction.op == TacOp::LABEL) {
+      blocks_.back().label = instruction.target.name;
+      label_block[instruction.target.name] = blocks_.size() - 1;
+    }
+    leader = instruction.op == TacOp::GOTO || instruction.op == TacOp::IF || instruction.op == TacOp::RETURN;
+  }
+  if (!blocks_.empty()) blocks_.back().end = code.size();
+
+  for (size_t b = 0; b < blocks_.size(); ++b) {
+    const TacInstruction& last = code[blocks_[b].end - 1];
+    auto link = [&](size_t next) {
+      auto& successors = blocks_[b].successors;
+      if (std::find(successors.begin(), successors.end(), next) != successors.end()) return;
+      successors.push_back(next);
+      blocks_[next].predecessors.push_back(b);
+    };
+    auto jump_to = [&](const TacOperand& label) {
+      auto it = label_block.find(label.name);
+      if (it != label_block.end()) link(it->second);
+    };
+    switch (last.op) {
+      case TacOp::GOTO:
+        jump_to(last.target);
+        break;
+      case TacOp::IF:
+        jump_to(last.target);
+        jump_to(last.alternative);
+        break;
+      case TacOp::RETURN:
+        break;
+      default:
+        if (b + 1 < blocks_.size()) link(b + 1);
+        break;
+    }
+  }
+}
+
+size_t ControlFlowGraph::block_of(size_t instruction) const {
+  auto it = std::upper_bound(blocks_.begin(), blocks_.end(), instruction,
+                             [](size_t i, const Block& block) { return i < block.begin; });
+  return static_cast<size_t>(it - blocks_.begin()) - 1;
+}
+
+void ControlFlowGraph::build_dominators() {
+  const size_t n = blocks_.size();
+  idom_.assign(n, NONE);
+  children_.assign(n, {});
+  preorder_.assign(n, 0);
+  postorder_.assign(n, 0);
+  if (n == 0) return;
+
+  // 逆后序（非递归深度优先）
+  std::vector<size_t> order;
+  std::vector<bool> visited(n, false);
+  std::vector<std::pair<size_t, size_t>> stack = { { 0, 0 } };
+  visited[0] = true;
+  while (!stack.empty()) {
+    auto& [b, next] = stack.back();
+    if (next < blocks_[b].successors.size()) {
+      size_t s = blocks_[b].successors[next++];
+      if (!visited[s]) {
+        visited[s] = true;
+        stack.emplace_back(s, 0);
+      }
+      continue;
+    }
+    order.push_back(b);
+    stack.pop_back();
+  }
+  reverse_postorder_.assign(order.rbegin(), order.rend());
+
+  // Cooper–Harvey–Kennedy：按逆后序迭代，沿直接支配者链求两个前驱的最近公共支配者
+  std::vector<size_t> rank(n, NONE);
+  for (size_t k = 0; k < reverse_postorder_.size(); ++k) rank[reverse_postorder_[k]] = k;
+  auto intersect = [&](size_t a, size_t b) {
+    while (a != b) {
+      while (rank[a] > rank[b]) a = idom_[a];
+      while (rank[b] > rank[a]) b = idom_[b];
+    }
+    return a;
+  };
+  idom_[0] = 0;
+  for (bool changed = true; changed;) {
+    changed = false;
+    for (size_t k = 1; k < reverse_postorder_.size(); ++k) {
+      const size_t b = reverse_postorder_[k];
+      size_t dominator = NONE;
+      for (size_t p : blocks_[b].predecessors) {
+        if (idom_[p] == NONE) continue;
+        dominator = dominator == NONE ? p : intersect(p, dominator);
+      }
+      if (idom_[b] != dominator) {
+        idom_[b] = dominator;
+        changed = true;
+      }
+    }
+  }
+  idom_[0] = NONE;
+
+  for (size_t b : reverse_postorder_) {
+    if (idom_[b] != NONE) children_[idom_[b]].push_back(b);
+  }
+  for (auto& children : children_) std::sort(children.begin(), children.end());
+
+  // 支配树的先序、后序编号
+  size_t pre = 0, post = 0;
+  std::vector<std::pair<size_t, size_t>> walk = { { 0, 0 } };
+  preorder_[0] = pre++;
+  while (!walk.empty()) {
+    auto& [b, next] = walk.back();
+    if (next < children_[b].size()) {
+      size_t child = children_[b][next++];
+      preorder_[child] = pre++;
+      walk.emplace_back(child, 0);
+      continue;
+    }
+    postorder_[b] = post++;
+    walk.pop_back();
+  }
+}
+
+bool ControlFlowGraph::dominates(size_t a, size_t b) const {
+  if (!reachable(a) || !reachable(b)) return false;
+  return preorder_[a] <= preorder_[b] && postorder_[b] <= postorder_[a];
+}
+
+void ControlFlowGraph::build_loops() {
+  const size_t n = blocks_.size();
+  loop_depth_.assign(n, 0);
+
+  // 每个循环头的循环体：从回边的尾逆着前驱走到头为止
+  std::unordered_map<size_t, std::vector<bool>> loops;
+  for (size_t b : reverse_postorder_) {
+    for (size_t h : blocks_[b].successors) {
+      if (!dominates(h, b)) continue;
+      auto [it, inserted] = loops.try_emplace(h, n, false);
+      std::vector<bool>& body = it->second;
+      body[h] = true;
+      std::vector<size_t> work;
+      if (!body[b]) {
+        body[b] = true;
+        work.push_back(b);
+      }
+      while (!work.empty()) {
+        size_t x = work.back();
+        work.pop_back();
+        for (size_t p : blocks_[x].predecessors) {
+          if (body[p] || !reachable(p)) continue;
+          body[p] = true;
+          work.push_back(p);
+        }
+      }
+    }
+  }
+  for (const auto& [header, body] : loops) {
+    for (size_t b = 0; b < n; ++b) {
+      if (body[b]) ++loop_depth_[b];
+    }
+  }
+}
+
+void ControlFlowGraph::to_dot(const std::string &filename) const {
+  std::ofstream file(filename);
+  if (!file.is_open()) {
+    throw std::runtime_error("Cannot open file to save dot: " + filename);
+  }
+  to_dot(file, "CFG");
+}
+
+void ControlFlowGraph::to_dot(std::ostream &out, const std::string &name, bool cluster) const {
+  const std::string indent = cluster ? "    " : "  ";
+  auto node = [&](size_t b) { return "\"" + (cluster ? name + "_" : "") + "B" + std::to_string(b) + "\""; };
+
+  if (cluster) {
+    out << "  subgraph \"cluster_" << name << "\" {\n";
+    out << indent << "label=\"" << name << "\";\n";
+  } else {
+    out << "digraph \"" << name << "\" {\n";
+  }
+  out << indent << "node [shape=box];\n"; // 节点用矩形框
+
+  // 块结点：第一行是块号，其余每行一条指令（\l 左对齐）
+  for (size_t b = 0; b < blocks_.size(); ++b) {
+    std::ostringstream label;
+    label << "B" << b << "\\l";
+    for (size_t i = blocks_[b].begin; i < blocks_[b].end; ++i) {
+      std::ostringstream text;
+      text << (*code_)[i];
+      for (char c : text.str()) {
+        if (c == '"' || c == '\\') label << '\\';
+        label << c;
+      }
+      label << "\\l";
+    }
+    out << indent << node(b) << " [label=\"" << label.str() << "\"];\n";
+  }
+
+  // 控制流边、支配树边
+  for (size_t b = 0; b < blocks_.size(); ++b) {
+    for (size_t s : blocks_[b].successors) {
+      out << indent << node(b) << " -> " << node(s) << ";\n";
+    }
+  }
+  for (size_t b = 0; b < blocks_.size(); ++b) {
+    for (size_t child : children_[b]) {
+      out << indent << node(b) << " -> " << node(child) << " [style=dashed, color=gray];\n";
+    }
+  }
+
+  out << (cluster ? "  }\n" : "}\n");
+}
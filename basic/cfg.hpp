@@ -0,0 +1,68 @@
+#ifndef CFG_HPP
+#define CFG_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "tac.hpp"
+
+// 一个函数三地址代码的控制流图：基本块、前驱与后继、支配树、自然循环的嵌套深度。
+// 块按代码顺序编号，块 0 是入口；图只记录指令下标，code 必须在图的生命周期内有效
+class ControlFlowGraph {
+public:
+  static constexpr size_t NONE = SIZE_MAX;
+
+  // 基本块：指令 [begin, end)。LABEL 和 GOTO、IF、RETURN 的下一条开始新块
+  struct Block {
+    size_t begin = 0;
+    size_t end = 0;
+    std::string label;                // 块首 LABEL 的标号，没有时为空
+    std::vector<size_t> successors;   // 顺序执行、GOTO 和 IF 的目标；以 RETURN 结尾的块没有后继
+    std::vector<size_t> predecessors;
+  };
+
+  explicit ControlFlowGraph(const TacCode& code);
+
+  // 基本块
+  size_t size() const { return blocks_.size(); }
+  const Block& block(size_t b) const { return blocks_[b]; }
+  const std::vector<Block>& blocks() const { return blocks_; }
+
+  // 指令 i 所在的块
+  size_t block_of(size_t instruction) const;
+
+  // 从入口可达的块的逆后序
+  const std::vector<size_t>& reverse_postorder() const { return reverse_postorder_; }
+  bool reachable(size_t b) const { return b == 0 ? !blocks_.empty() : idom_[b] != NONE; }
+
+  // 支配树：入口和不可达块的直接支配者为 NONE
+  size_t immediate_dominator(size_t b) const { return idom_[b]; }
+  const std::vector<size_t>& dominator_children(size_t b) const { return children_[b]; }
+  bool dominates(size_t a, size_t b) const;
+
+  // 块所在自然循环的层数：回边 b -> h（h 支配 b）确定以 h 为头的循环，同一个头的回边合为一个循环
+  int loop_depth(size_t b) const { return loop_depth_[b]; }
+
+  // 转为 dot：块内列出指令，实线为控制流，虚线为支配树
+  void to_dot(const std::string &filename) const;
+  // 写成名为 name 的 digraph，或 cluster 为真时写成 subgraph cluster_name（结点名加 name 前缀）
+  void to_dot(std::ostream &out, const std::string &name, bool cluster = false) const;
+
+private:
+  const TacCode* code_;
+  std::vector<Block> blocks_;
+  std::vector<size_t> reverse_postorder_;
+  std::vector<size_t> idom_;
+  std::vector<std::vector<size_t>> children_;
+  std::vector<size_t> preorder_;   // 支配树的先序、后序编号，用于 O(1) 判断支配关系
+  std::vector<size_t> postorder_;
+  std::vector<int> loop_depth_;
+
+  void build_blocks();
+  void build_dominators();
+  void build_loops();
+};
+
+#endif // CFG_HPP
@@ -3,6 +3,7 @@
 //
 
 #include "code.hpp"
+#include "utils/strtool.hpp"
 
 // 三地址代码
 
@@ -22,57 +23,37 @@ void Code::to_three_addr_code(const std::string &filename) {
 
 std::string Code::table_to_three_addr_code(const TablePtr &table) {
   std::ostringstream out;
-  std::string line;
-  std::istringstream iss(merge_code(table));
 
   if (table->name != "system_table") {
     out << "LABEL " << table->name << ";\n";
   }
 
-  while (std::getline(iss, line)) {
-    if (line.find("LABEL") == std::string::npos) {
-      out << "  " << line << '\n';
-    } else {
-      out << line << '\n';
-    }
+  // 标号顶格，其余指令缩进两格
+  for (const auto& instruction : table->code) {
+    if (instruction.op != TacOp::LABEL) out << "  ";
+    out << instruction << '\n';
   }
   return out.str();
 }
 
-// MIPS
-
-void Code::parse_mips_regex(const std::string &filename) {
-  std::ifstream in(filename);
-  if (!in.is_open()) {
-    throw std::runtime_error("[Code] 无法打开 json 文件: " + filename);
+void Code::cfg_to_dot(const std::string &filename) const {
+  std::ofstream out(filename);
+  if (!out.is_open()) {
+    std::cerr << "[Code] 无法打开文件" << filename << std::endl;
+    return;
   }
-
-  json j;
-  in >> j;
-
-  mips_regex_rules_.clear();
-
-  std::vector<std::pair<int, std::pair<Pattern, Replacement>>> rules_with_priority;
-
-  for (const auto& [priority_str, rule_group] : j.items()) {
-    int priority = std::stoi(priority_str);
-    for (const auto& [rule_name, rule_obj] : rule_group.items()) {
-      std::string pattern_str = rule_obj["pattern"];
-      std::string replacement = rule_obj["replacement"];
-
-      Pattern compiled("^" + pattern_str);
-      rules_with_priority.emplace_back(priority, std::make_pair(compiled, replacement));
-    }
+  out << "digraph CFG {\n";
+  ControlFlowGraph(map_symbol_table_.at("system_table")->code).to_dot(out, "main", true);
+  for (const auto& [name, table] : map_symbol_table_) {
+    if (name != "system_table") ControlFlowGraph(table->code).to_dot(out, table->name, true);
   }
+  out << "}\n";
+}
 
-  std::sort(rules_with_priority.begin(), rules_with_priority.end(),
-  [](const auto& a, const auto& b) {
-    return a.first < b.first;
-  });
+// MIPS
 
-  for (const auto& [priority, pair] : rules_with_priority) {
-    mips_regex_rules_.push_back(pair);
-  }
+void Code::parse_mips_regex(const std::string &filename) {
+  mips_selector_.load(filename);
 }
 
 void Code::to_mips(const std::string &filename) {
@@ -83,16 +64,40 @@ void Code::to_mips(const std::string &filename) {
   }
   // 先加 system_table.code
   TablePtr system_table = map_symbol_table_["system_table"];
-  out << table_to_mips(system_table);
+  allocation_report_.clear();
+  if (opt_level_ == OptLevel::O0) {
+    out << table_to_mips(system_table);
+    for (const auto& [name, table] : map_symbol_table_) {
+      if (name != "system_table") out << table_to_mips(table);
+    }
+    return;
+  }
+
+  find_escaped();
+  out << data_section();
+  out << table_to_allocated_mips(system_table, true);
   for (const auto& [name, table] : map_symbol_table_) {
-    if (name != "system_table") out << table_to_mips(table);
+    if (name != "system_table") out << table_to_allocated_mips(table, false);
+  }
+}
+
+void Code::allocation_report_to_txt(const std::string &filename) const {
+  std::ofstream out(filename);
+  if (!out.is_open()) {
+    std::cerr << "[Code] 无法打开文件" << filename << std::endl;
+    return;
+  }
+  for (const auto& report : allocation_report_) {
+    out << report.function << ": 候选 " << report.values << "，寄存器 " << report.registers
+        << "，move " << report.moves << "，删除 " << report.moves_removed
+        << "，溢出 " << report.spilled.size();
+    for (size_t i = 0; i < report.spilled.size(); ++i) out << (i == 0 ? " (" : ", ") << report.spilled[i];
+    out << (report.spilled.empty() ? "\n" : ")\n");
   }
 }
 
 std::string Code::table_to_mips(const TablePtr &table) {
   std::ostringstream out;
-  std::string line;
-  std::istringstream iss(merge_code(table));
 
   if (table->name != "system_table") {
     out << table->name << ":\n";
@@ -105,73 +110,321 @@ std::string Code::table_to_mips(const TablePtr &table) {
     out << "  addi $sp, $sp, 4\n";
   }
 
-  out << three_addr_code_to_mips(iss.str());
+  out << three_addr_code_to_mips(table->code);
   return out.str();
 }
 
-std::string Code::three_addr_code_to_mips(const std::string &code_text) {
-  std::istringstream in(code_text);
+std::string Code::three_addr_code_to_mips(const TacCode &code) const {
   std::ostringstream out;
 
-  std::string line;
   int line_number = 1;
+  for (const auto& instruction : code) {
+    if (!mips_selector_.select(instruction, out)) {
+      std::cerr << "[Code] " << line_number << ": 未识别的语句 " << instruction << '\n';
+    }
+    ++line_number;
+  }
+
+  return out.str();
+}
+
+// 寄存器分配（O1、O2）
+
+namespace {
+
+// 装入溢出值、静态区变量和常量用的临时寄存器，一条指令最多三个操作数
+const char* const SCRATCH_REGISTERS[] = { "$a1", "$a2", "$a3" };
+
+std::string entry_type(const Syntax::EntryPtr &entry) {
+  return entry ? strtool::to_lower(entry->type) : "";
+}
+
+// 值本身可以放进寄存器的登记项：标量变量和指针参数
+bool is_scalar(const Syntax::EntryPtr &entry) {
+  const std::string type = entry_type(entry);
+  return type == "int" || type == "float" || type == "funptt" || type == "arrptt";
+}
+
+} // namespace
+
+std::pair<Syntax::EntryPtr, const Syntax::Table*> Code::resolve(const Syntax::Table *table, const std::string &name) {
+  for (; table; table = table->outer.get()) {
+    for (const auto& entry : table->entries) {
+      if (entry->name == name) return { entry, table };
+    }
+  }
+  return { nullptr, nullptr };
+}
+
+bool Code::is_candidate(const Syntax::Table *table, const TacOperand &operand) const {
+  if (operand.kind == TacOperand::TEMP) return true;
+  if (operand.kind != TacOperand::VARIABLE && operand.kind != TacOperand::FUNCTION) return false;
+  auto [entry, owner] = resolve(table, operand.name);
+  return owner == table && is_scalar(entry) && !escaped_.count({ owner, operand.name });
+}
+
+std::string Code::static_label(const Syntax::Table *owner, const std::string &name) {
+  return owner->name == "system_table" ? name : owner->name + "_" + name;
+}
 
-  while (std::getline(in, line)) {
-    line.erase(line.begin(), std::find_if_not(line.begin(), line.end(), ::isspace));
-
-    bool matched = false;
-
-    for (const auto& [pattern, replacement] : mips_regex_rules_) {
-      std::smatch match;
-      if (std::regex_match(line, match, pattern)) {
-        std::string result = replacement;
-
-        // 替换 \$1, \$2,... 占位符（正则组）
-        for (size_t i = 1; i < match.size(); ++i) {
-          // 替换 $1
-          std::string placeholder_plain = "\\$" + std::to_string(i);
-          result = std::regex_replace(result, std::regex(placeholder_plain), match[i].str());
-
-          // 替换 $t$1 形式（寄存器拼接）
-          std::string placeholder_nested = "\\$([a-zA-Z]*)\\$" + std::to_string(i);
-          result = std::regex_replace(result, std::regex(placeholder_nested),
-                                      match[i].str().empty() ? "" : "$$1" + match[i].str());
-        }
-
-        // 把\$替换为$
-        result = std::regex_replace(result, std::regex(R"(\\\$)"), "$");
-        // 最后把 \n 字符串替换为换行符
-        result = std::regex_replace(result, std::regex(R"(\\n)"), "\n");
-
-        std::istringstream result_stream(result);
-        std::string mips_line;
-        while (std::getline(result_stream, mips_line)) {
-          if (mips_line.find(':') != std::string::npos) {
-            out << mips_line << '\n';
-          } else {
-            out << "  " << mips_line << '\n';
-          }
-        }
-
-        matched = true;
-        break;
+void Code::find_escaped() {
+  // 没有静态链，内层函数访问的外层变量（包括全局变量）统一放在静态区
+  escaped_.clear();
+  std::vector<const TacOperand*> operands;
+  for (const auto& [name, table] : map_symbol_table_) {
+    for (const auto& instruction : table->code) {
+      instruction.used(operands);
+      if (const TacOperand* defined = instruction.defined()) operands.push_back(defined);
+      for (const TacOperand* operand : operands) {
+        if (operand->kind != TacOperand::VARIABLE && operand->kind != TacOperand::FUNCTION) continue;
+        auto [entry, owner] = resolve(table.get(), operand->name);
+        if (owner && owner != table.get() && is_scalar(entry)) escaped_.emplace(owner, operand->name);
       }
     }
+  }
+}
 
-    if (!matched && !line.empty()) {
-      std::cerr << "[Code] " << line_number << ": 未识别的语句 " << line << '\n';
+std::string Code::data_section() const {
+  // 数组按原名放在静态区（mips.json 的数组规则用 la 取数组名的地址），元素按字计
+  std::vector<std::pair<std::string, std::string>> data;
+  std::set<std::string> labels;
+  auto add = [&](const std::string &label, const std::string &directive) {
+    if (labels.insert(label).second) data.emplace_back(label, directive);
+  };
+  auto add_arrays = [&](const TablePtr &table) {
+    for (const auto& entry : table->entries) {
+      if (entry_type(entry) != "array") continue;
+      auto array = std::dynamic_pointer_cast<Syntax::ArrayEntry>(entry);
+      int length = 1;
+      for (int d : array->dim) length *= d;
+      add(entry->name, ".space " + std::to_string(4 * length));
     }
+  };
+  add_arrays(map_symbol_table_.at("system_table"));
+  for (const auto& [name, table] : map_symbol_table_) {
+    if (name != "system_table") add_arrays(table);
+  }
+  std::vector<std::string> statics;
+  for (const auto& [owner, name] : escaped_) statics.push_back(static_label(owner, name));
+  std::sort(statics.begin(), statics.end());
+  for (const auto& label : statics) add(label, ".word 0");
 
-    ++line_number;
+  if (data.empty()) return "";
+  std::ostringstream out;
+  out << ".data\n";
+  for (const auto& [label, directive] : data) out << label << ": " << directive << "\n";
+  out << ".text\n";
+  return out.str();
+}
+
+std::string Code::address_of(const Frame &frame, const std::string &name) const {
+  auto slot = frame.spill_slots.find(name);
+  if (slot != frame.spill_slots.end()) return std::to_string(slot->second) + "($fp)";
+
+  const Syntax::Table* table = frame.table.get();
+  auto [entry, owner] = resolve(table, name);
+  if (!entry) return name;
+  if (owner != table || escaped_.count({ owner, name })) return static_label(owner, name);
+
+  const auto& arglist = table->arglist;
+  auto arg = std::find(arglist.begin(), arglist.end(), name);
+  if (arg != arglist.end()) return std::to_string(4 * (arg - arglist.begin())) + "($fp)";
+  return std::to_string(-(frame.saved_base + entry->offset)) + "($fp)";
+}
+
+std::string Code::epilogue(const Frame &frame) {
+  std::ostringstream out;
+  const auto& saved = frame.assignment.saved_registers;
+  for (size_t k = 0; k < saved.size(); ++k) {
+    out << "  lw " << saved[k] << ", " << -static_cast<int>(12 + 4 * k) << "($fp)\n";
   }
+  out << "  lw $ra, -4($fp)\n";
+  out << "  move $sp, $fp\n";
+  out << "  lw $fp, -8($sp)\n";
+  // 实参由被调用者弹出
+  if (!frame.table->arglist.empty()) out << "  addi $sp, $sp, " << 4 * frame.table->arglist.size() << "\n";
+  return out.str();
+}
 
+std::string Code::table_to_allocated_mips(const TablePtr &table, bool main) {
+  Frame frame;
+  frame.table = table;
+  frame.main = main;
+
+  const Syntax::Table* t = table.get();
+  Liveness liveness(table->code, [&](const TacOperand &operand) { return is_candidate(t, operand); });
+  frame.assignment = opt_level_ == OptLevel::O2 ? GraphColoringAllocator().allocate(table->code, liveness)
+                                                : LinearScanAllocator().allocate(table->code, liveness);
+  frame.registers = frame.assignment.registers;
+  // main 不返回，不需要保存 $s 寄存器
+  if (main) frame.assignment.saved_registers.clear();
+  frame.saved_base = 8 + 4 * static_cast<int>(frame.assignment.saved_registers.size());
+
+  int spills = 0;
+  for (const auto& name : frame.assignment.spilled) {
+    if (resolve(t, name).first) continue;  // 变量溢出到自己在变量区的位置
+    frame.spill_slots[name] = -(frame.saved_base + table->width + 4 * ++spills);
+  }
+  frame.size = frame.saved_base + table->width + 4 * spills;
+
+  std::ostringstream out;
+  if (main) {
+    out << "main:\n";
+    out << "  move $fp, $sp\n";
+    out << "  addi $sp, $sp, -" << frame.size << "\n";
+  } else {
+    out << table->name << ":\n";
+    out << "  addi $sp, $sp, -" << frame.size << "\n";
+    out << "  sw $ra, " << frame.size - 4 << "($sp)\n";
+    out << "  sw $fp, " << frame.size - 8 << "($sp)\n";
+    out << "  addi $fp, $sp, " << frame.size << "\n";
+    const auto& saved = frame.assignment.saved_registers;
+    for (size_t k = 0; k < saved.size(); ++k) {
+      out << "  sw " << saved[k] << ", " << -static_cast<int>(12 + 4 * k) << "($fp)\n";
+    }
+    // 入口处活跃的参数装入分到的寄存器（先定值后引用的参数可能与别的参数共用寄存器，不能装入）；
+    // 被内层函数访问的参数复制到静态区，其余留在实参的位置
+    auto live_on_entry = [&](const std::string &name) {
+      const int value = liveness.value(name);
+      return value >= 0 && liveness.block_count() > 0 && liveness.live_in(0).contains(value);
+    };
+    for (size_t k = 0; k < table->arglist.size(); ++k) {
+      const std::string& name = table->arglist[k];
+      auto reg = frame.assignment.registers.find(name);
+      if (reg != frame.assignment.registers.end()) {
+        if (live_on_entry(name)) out << "  lw " << reg->second << ", " << 4 * k << "($fp)\n";
+      } else if (escaped_.count({ t, name })) {
+        out << "  lw " << SCRATCH_REGISTERS[0] << ", " << 4 * k << "($fp)\n";
+        out << "  sw " << SCRATCH_REGISTERS[0] << ", " << static_label(t, name) << "\n";
+      }
+    }
+  }
+
+  int line_number = 1;
+  for (const auto& instruction : table->code) {
+    allocated_instruction_to_mips(frame, instruction, line_number++, out);
+  }
+
+  // 执行到末尾：main 退出，其余函数返回 0
+  const bool falls_through = table->code.empty() || (table->code.back().op != TacOp::RETURN &&
+                                                     table->code.back().op != TacOp::GOTO);
+  if (falls_through && main) {
+    out << "  li $v0, 10\n";
+    out << "  syscall\n";
+  } else if (falls_through) {
+    out << epilogue(frame);
+    out << "  addi $sp, $sp, -4\n";
+    out << "  sw $zero, 0($sp)\n";
+    out << "  jr $ra\n";
+  }
+
+  AllocationReport report;
+  report.function = main ? "main" : table->name;
+  report.values = liveness.value_count();
+  std::set<std::string> registers;
+  for (const auto& [name, reg] : frame.assignment.registers) registers.insert(reg);
+  report.registers = registers.size();
+  report.spilled = frame.assignment.spilled;
+  for (size_t i = 0; i < liveness.size(); ++i) {
+    if (table->code[i].op == TacOp::ASSIGN && liveness.def(i) >= 0 && liveness.uses(i).size() == 1) ++report.moves;
+  }
+  report.moves_removed = frame.moves_removed;
+  allocation_report_.push_back(std::move(report));
   return out.str();
 }
 
-std::string Code::merge_code(const TablePtr &table) {
-  std::ostringstream result;
-  for (const auto& code : table->code) {
-    result << code;
+void Code::allocated_instruction_to_mips(Frame &frame, const TacInstruction &instruction, int line_number,
+                                         std::ostream &out) const {
+  const Syntax::Table* table = frame.table.get();
+  // 两端分到同一寄存器的 move 不生成代码
+  if (instruction.op == TacOp::ASSIGN && instruction.src1.kind != TacOperand::CONSTANT) {
+    auto dst = frame.assignment.registers.find(instruction.dst.name);
+    auto src = frame.assignment.registers.find(instruction.src1.name);
+    if (dst != frame.assignment.registers.end() && src != frame.assignment.registers.end() &&
+        dst->second == src->second) {
+      ++frame.moves_removed;
+      return;
+    }
+  }
+
+  std::ostringstream pre, body, post;
+  std::vector<std::pair<std::string, std::string>> restore;  // 本条指令临时改过的 (名字, 原寄存器)
+  size_t scratch = 0;
+
+  auto bind = [&](const std::string &name, const std::string &reg) {
+    auto it = frame.registers.find(name);
+    restore.emplace_back(name, it == frame.registers.end() ? "" : it->second);
+    frame.registers[name] = reg;
+  };
+  auto is_function = [&](const TacOperand &operand) {
+    return entry_type(resolve(table, operand.name).first) == "func";
+  };
+
+  // 引用的值不在寄存器中时先装入临时寄存器
+  // mips.json 的规则只接受名字作操作数，其余位置的常量改名为装入它的临时寄存器
+  TacInstruction renamed = instruction;
+  std::vector<const TacOperand*> operands;
+  instruction.used(operands);
+  for (const TacOperand* operand : operands) {
+    if (operand->empty() || frame.registers.count(operand->name)) continue;
+    if (operand->kind == TacOperand::CONSTANT && instruction.op == TacOp::ASSIGN) continue;  // li 规则直接装入
+    if (operand == &instruction.target && is_function(*operand)) continue;                  // 直接调用
+
+    const std::string reg = SCRATCH_REGISTERS[scratch++];
+    const std::string type = entry_type(resolve(table, operand->name).first);
+    if (operand->kind == TacOperand::CONSTANT) {
+      TacOperand& copy = operand == &instruction.src1 ? renamed.src1
+                       : operand == &instruction.src2 ? renamed.src2 : renamed.target;
+      copy = TacOperand::temp("_" + reg.substr(1));
+      pre << "  li " << reg << ", " << operand->name << "\n";
+      bind(copy.name, reg);
+      continue;
+    }
+    if (type == "func" || type == "array") {
+      pre << "  la " << reg << ", " << operand->name << "\n";
+    } else {
+      pre << "  lw " << reg << ", " << address_of(frame, operand->name) << "\n";
+    }
+    bind(operand->name, reg);
+  }
+
+  // 定值的名字没有分到寄存器时写到临时寄存器，指令之后存回
+  const TacOperand* defined = instruction.defined();
+  if (defined && !defined->empty() && !frame.assignment.registers.count(defined->name)) {
+    if (!frame.registers.count(defined->name)) bind(defined->name, SCRATCH_REGISTERS[scratch++]);
+    post << "  sw " << frame.registers[defined->name] << ", " << address_of(frame, defined->name) << "\n";
+  }
+
+  bool selected = false;
+  if (renamed.op == TacOp::RETURN && frame.main) {
+    body << "  li $v0, 10\n";
+    body << "  syscall\n";
+    selected = true;
+  } else if (renamed.op == TacOp::RETURN) {
+    // 返回值经 $v0 带过尾声，再按规则压栈返回
+    pre << "  move $v0, " << frame.registers[renamed.src1.name] << "\n";
+    pre << epilogue(frame);
+    bind(renamed.src1.name, "$v0");
+  } else if (renamed.op == TacOp::CALL && !is_function(renamed.target)) {
+    // 通过函数指针参数调用
+    body << "  jalr " << frame.registers[instruction.target.name] << "\n";
+    body << "  lw " << frame.registers[instruction.dst.name] << ", 0($sp)\n";
+    body << "  addi $sp, $sp, 4\n";
+    selected = true;
+  }
+  if (!selected) selected = mips_selector_.select(renamed, body, &frame.registers);
+
+  if (selected) {
+    out << pre.str() << body.str() << post.str();
+  } else {
+    std::cerr << "[Code] " << line_number << ": 未识别的语句 " << instruction << '\n';
+  }
+
+  for (auto it = restore.rbegin(); it != restore.rend(); ++it) {
+    if (it->second.empty()) {
+      frame.registers.erase(it->first);
+    } else {
+      frame.registers[it->first] = it->second;
+    }
   }
-  return result.str();
 }
@@ -4,19 +4,35 @@
 
 #ifndef CODE_HPP
 #define CODE_HPP
+#include <set>
+
 #include "syntax.hpp"
-#include "utils/json.hpp"
+#include "mips_selector.hpp"
+#include "register_allocator.hpp"
 
 
-using json = nlohmann::json;
 using TablePtr = Syntax::TablePtr;
-using Pattern = std::regex;
-using Replacement = std::string;
 
 const std::string MIPS_REGEX_FILE = "input/code_regex/mips.json";
 
 class Code {
 public:
+  // 优化级别
+  // O0：不分配寄存器，每个名字原样作为符号寄存器（$x、$t8），只用来对照 mips.json 规则的输出
+  // O1：每个函数做活跃变量分析和线性扫描寄存器分配，输出带 .data 段、main 入口和栈帧、可以运行的程序
+  // O2：同 O1，寄存器分配改用图着色并合并 move
+  enum class OptLevel { O0, O1, O2 };
+
+  // 一个函数的寄存器分配统计（O1、O2）
+  struct AllocationReport {
+    std::string function;              // 函数名，system_table 记为 main
+    size_t values = 0;                 // 参与分配的候选个数
+    size_t registers = 0;              // 用到的物理寄存器个数
+    std::vector<std::string> spilled;  // 溢出的候选
+    size_t moves = 0;                  // 两端都是候选的 move 条数
+    size_t moves_removed = 0;          // 两端分到同一寄存器、不再生成的 move 条数
+  };
+
   Code(Syntax &syntax) : syntax_(syntax) {
     map_symbol_table_ = syntax_.symbol_table();
   }
@@ -24,15 +40,58 @@ public:
   void to_mips(const std::string &filename);
   void parse_mips_regex(const std::string &filename);
 
+  // 每个函数的控制流图写入一个 dot 文件，一个函数一个 cluster（system_table 记为 main）
+  void cfg_to_dot(const std::string &filename) const;
+
+  // 设置 / 查询优化级别，默认 O1
+  void set_opt_level(OptLevel level) { opt_level_ = level; }
+  OptLevel opt_level() const { return opt_level_; }
+
+  // 最近一次 to_mips 的寄存器分配统计，每个函数一项；O0 时为空
+  const std::vector<AllocationReport>& allocation_report() const { return allocation_report_; }
+  void allocation_report_to_txt(const std::string &filename) const;
+
 private:
+  // 一个函数的栈帧：$fp 指向调用者压入的第一个实参，向下依次是
+  // $ra、旧 $fp、保存的 $s 寄存器、Table::width 大小的变量区（变量 v 在 -(K + v.offset)($fp)）、临时变量的溢出槽
+  struct Frame {
+    TablePtr table;
+    bool main = false;                                   // system_table 的代码作为 main
+    RegisterAssignment assignment;                       // 寄存器分配结果
+    MipsSelector::RegisterMap registers;                 // 当前指令用到的名字 -> 寄存器（含临时装入的）
+    std::unordered_map<std::string, int> spill_slots;    // 溢出的临时变量 -> 相对 $fp 的偏移
+    int saved_base = 8;                                  // K：变量区之上的字节数
+    int size = 0;                                        // 栈帧字节数
+    size_t moves_removed = 0;                            // 省去的 move 条数
+  };
+
   Syntax &syntax_;
   std::unordered_map<std::string, TablePtr> map_symbol_table_;
-  std::vector<std::pair<Pattern, Replacement>> mips_regex_rules_;
+  MipsSelector mips_selector_;  // mips.json 编译成的指令选择规则
+  OptLevel opt_level_ = OptLevel::O1;
+  std::set<std::pair<const Syntax::Table*, std::string>> escaped_;  // 被内层函数访问、放在静态区的变量
+  std::vector<AllocationReport> allocation_report_;
 
   static std::string table_to_three_addr_code(const TablePtr &table);
   std::string table_to_mips(const TablePtr &table);
-  std::string three_addr_code_to_mips(const std::string &code_text);
-  static std::string merge_code(const TablePtr &table);
+  std::string three_addr_code_to_mips(const TacCode &code) const;
+
+  // O1、O2
+  void find_escaped();
+  std::string data_section() const;
+  std::string table_to_allocated_mips(const TablePtr &table, bool main);
+  void allocated_instruction_to_mips(Frame &frame, const TacInstruction &instruction, int line_number,
+                                     std::ostream &out) const;
+  static std::string epilogue(const Frame &frame);
+
+  // 名字所属的登记项和符号表（从 table 向外层查找），找不到时返回空
+  static std::pair<Syntax::EntryPtr, const Syntax::Table*> resolve(const Syntax::Table *table, const std::string &name);
+  // 是否参与 table 的寄存器分配：临时变量，和没有被内层函数访问的本函数标量变量、指针参数
+  bool is_candidate(const Syntax::Table *table, const TacOperand &operand) const;
+  // 静态区的标号：全局变量和数组用原名，函数的局部变量加函数名前缀
+  static std::string static_label(const Syntax::Table *owner, const std::string &name);
+  // 不在寄存器中的值的内存地址，如 "-12($fp)"、"4($fp)"、"a"
+  std::string address_of(const Frame &frame, const std::string &name) const;
 };
 
 
@@ -0,0 +1,71 @@
+#include "code_rope.hpp"
+
+#include <sstream>
+#include <vector>
+
+CodeRope::CodeRope(TacInstruction instruction) : root_(std::make_shared<Node>()) {
+  root_->instruction = std::move(instruction);
+  root_->size = 1;
+}
+
+CodeRope& CodeRope::operator+=(const CodeRope& other) {
+  if (other.empty()) return *this;
+  if (empty()) {
+    root_ = other.root_;
+    return *this;
+  }
+  auto node = std::make_shared<Node>();
+  node->size = root_->size + other.root_->size;
+  node->left = std::move(root_);
+  node->right = other.root_;
+  root_ = std::move(node);
+  return *this;
+}
+
+template <class Visitor>
+void CodeRope::visit_leaves(const Node* root, Visitor visit) {
+  std::vector<const Node*> pending;
+  if (root) pending.push_back(root);
+  while (!pending.empty()) {
+    const Node* node = pending.back();
+    pending.pop_back();
+    if (!node->left && !node->right) {
+      visit(node->instruction);
+      continue;
+    }
+    if (node->right) pending.push_back(node->right.get());
+    if (node->left) pending.push_back(node->left.get());
+  }
+}
+
+TacCode CodeRope::instructions() const {
+  TacCode code;
+  code.reserve(size());
+  visit_leaves(root_.get(), [&](const TacInstruction& instruction) { code.push_back(instruction); });
+  return code;
+}
+
+void CodeRope::write(std::ostream& os) const {
+  visit_leaves(root_.get(), [&](const TacInstruction& instruction) { os << instruction << "\n"; });
+}
+
+std::string CodeRope::str() const {
+  std::ostringstream os;
+  write(os);
+  return os.str();
+}
+
+CodeRope::Node::~Node() {
+  // 长拼接链逐层递归析构会栈溢出：只被本节点持有的子节点先摘下来，循环释放
+  std::vector<std::shared_ptr<Node>> pending;
+  if (left) pending.push_back(std::move(left));
+  if (right) pending.push_back(std::move(right));
+  while (!pending.empty()) {
+    std::shared_ptr<Node> node = std::move(pending.back());
+    pending.pop_back();
+    if (node.use_count() == 1) {
+      if (node->left) pending.push_back(std::move(node->left));
+      if (node->right) pending.push_back(std::move(node->right));
+    }
+  }
+}
@@ -0,0 +1,65 @@
+#ifndef CODE_ROPE_HPP
+#define CODE_ROPE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <string>
+
+#include "tac.hpp"
+
+// 只追加的三地址代码串（rope）：拼接只新建一个节点，O(1)，子串在各个拼接结果之间共享；
+// 需要时才按顺序展开成指令序列或文本。语义属性里的代码用它沿分析栈向上传递
+class CodeRope {
+public:
+  // 空代码
+  CodeRope() = default;
+
+  // 一条指令
+  CodeRope(TacInstruction instruction);
+
+  // 在末尾拼接，O(1)
+  CodeRope& operator+=(const CodeRope& other);
+
+  friend CodeRope operator+(CodeRope left, const CodeRope& right) {
+    left += right;
+    return left;
+  }
+
+  bool empty() const { return size() == 0; }
+
+  // 指令条数
+  size_t size() const { return root_ ? root_->size : 0; }
+
+  // 按顺序展开为指令序列（非递归，拼接链再长也不会栈溢出）
+  TacCode instructions() const;
+
+  // 按顺序逐行输出文本
+  void write(std::ostream& os) const;
+
+  // 展开为文本
+  std::string str() const;
+
+  friend std::ostream& operator<<(std::ostream& os, const CodeRope& rope) {
+    rope.write(os);
+    return os;
+  }
+
+private:
+  // 叶子保存一条指令；内部节点只有 left/right。节点建好后不再修改
+  struct Node {
+    TacInstruction instruction;
+    std::shared_ptr<Node> left;
+    std::shared_ptr<Node> right;
+    size_t size = 0;
+    ~Node();
+  };
+
+  std::shared_ptr<Node> root_;
+
+  // 从左到右访问每个叶子的指令
+  template <class Visitor>
+  static void visit_leaves(const Node* root, Visitor visit);
+};
+
+#endif // CODE_ROPE_HPP
@@ -3,6 +3,8 @@
 #include "item.hpp"
 #include "utils/format.hpp"
 #include "utils/strtool.hpp" // 引入新的字符串工具
+#include "utils/bittool.hpp"
+#include <algorithm>
 
 using namespace strtool; // 省得每次手动写 strtool::trim
 
@@ -31,6 +33,10 @@ Grammar::Grammar(const std::string& grammar_text) {
 Grammar::Grammar(const std::string& lhs, const std::vector<std::string>& rhs)
   : lhs_(lhs), rhs_(rhs) {}
 
+Grammar::Grammar(const std::string& lhs, const std::vector<std::string>& rhs,
+                 SymbolId lhs_id, const std::vector<SymbolId>& rhs_ids)
+  : lhs_(lhs), rhs_(rhs), lhs_id_(lhs_id), rhs_ids_(rhs_ids) {}
+
 const std::string& Grammar::lhs() const {
   return lhs_;
 }
@@ -39,6 +45,19 @@ const std::vector<std::string>& Grammar::rhs() const {
   return rhs_;
 }
 
+void Grammar::bind(SymbolInterner& symbols) {
+  lhs_id_ = symbols.intern(lhs_);
+  rhs_ids_.clear();
+  rhs_ids_.reserve(rhs_.size());
+  for (const auto& sym : rhs_) {
+    rhs_ids_.push_back(symbols.intern(sym));
+  }
+}
+
+bool Grammar::is_epsilon() const {
+  return rhs_.empty() || (rhs_.size() == 1 && rhs_[0] == "ε");
+}
+
 json Grammar::to_json() const {
   return rhs_;
 }
@@ -63,6 +82,24 @@ std::ostream& operator<<(std::ostream& os, const Grammar& grammar) {
   return os;
 }
 
+// ProductionTable 实现
+
+int ProductionTable::intern(const Grammar& grammar) {
+  auto it = ids_.find(grammar);
+  if (it != ids_.end()) return it->second;
+
+  int id = static_cast<int>(productions_.size());
+  productions_.push_back(grammar);
+  lengths_.push_back(grammar.is_epsilon() ? 0 : static_cast<uint32_t>(grammar.rhs().size()));
+  ids_.emplace(grammar, id);
+  return id;
+}
+
+int ProductionTable::find(const Grammar& grammar) const {
+  auto it = ids_.find(grammar);
+  return it == ids_.end() ? -1 : it->second;
+}
+
 // GrammarSet 实现
 
 GrammarSet::GrammarSet() : start_("") {}
@@ -85,7 +122,16 @@ GrammarSet::GrammarSet(const std::string& source, const std::string& start_symbo
 }
 
 void GrammarSet::add(const Grammar& grammar) {
-  grammars_[grammar.lhs()].push_back(grammar);
+  auto& productions = grammars_[grammar.lhs()];
+  productions.push_back(grammar);
+  productions.back().bind(*symbols_);
+
+  SymbolId lhs_id = productions.back().lhs_id();
+  if (lhs_productions_.size() <= static_cast<size_t>(lhs_id)) {
+    lhs_productions_.resize(lhs_id + 1);
+  }
+  lhs_productions_[lhs_id].push_back(productions_->intern(productions.back()));
+  closure_templates_.clear(); // 文法变了，模板等下次 bind_symbols() 重新计算
 }
 
 void GrammarSet::add(const std::string& grammar_text) {
@@ -94,6 +140,7 @@ void GrammarSet::add(const std::string& grammar_text) {
 }
 
 bool GrammarSet::parse(const std::string& grammar_text) {
+  checksum_ = fnv1a(grammar_text, checksum_);
   std::istringstream iss(grammar_text);
   return parse_stream(iss);
 }
@@ -104,7 +151,22 @@ bool GrammarSet::parse_file(const std::string& filename) {
     std::cerr << "Cannot open grammar file: " << filename << std::endl;
     return false;
   }
-  return parse_stream(file);
+  std::ostringstream oss;
+  oss << file.rdbuf();
+  return parse(oss.str());
+}
+
+uint64_t GrammarSet::checksum(const std::string& source) {
+  if (source.find("->") != std::string::npos) {
+    return fnv1a(source);
+  }
+  std::ifstream file(source);
+  if (!file.is_open()) {
+    return 0;
+  }
+  std::ostringstream oss;
+  oss << file.rdbuf();
+  return fnv1a(oss.str());
 }
 
 bool GrammarSet::parse(const std::string& grammar_text, const std::string& start_symbol) {
@@ -134,7 +196,72 @@ const std::vector<Grammar>& GrammarSet::operator[](const std::string& lhs) const
   return it->second;
 }
 
+const std::vector<int>& GrammarSet::productions_of(SymbolId lhs) const {
+  if (lhs < 0 || static_cast<size_t>(lhs) >= lhs_productions_.size()) {
+    static const std::vector<int> empty;
+    return empty;
+  }
+  return lhs_productions_[lhs];
+}
+
+void GrammarSet::bind_symbols() {
+  if (!start_.empty()) symbols_->intern(start_);
+  lhs_productions_.clear();
+  for (auto& [lhs, productions] : grammars_) {
+    for (auto& prod : productions) {
+      if (!prod.bound()) prod.bind(*symbols_);
+      SymbolId lhs_id = prod.lhs_id();
+      if (lhs_productions_.size() <= static_cast<size_t>(lhs_id)) {
+        lhs_productions_.resize(lhs_id + 1);
+      }
+      lhs_productions_[lhs_id].push_back(productions_->intern(prod));
+    }
+  }
+  compute_closure_templates();
+}
+
+const ClosureTemplate* GrammarSet::closure_template(SymbolId non_terminal) const {
+  if (non_terminal < 0 || static_cast<size_t>(non_terminal) >= closure_templates_.size()) {
+    return nullptr;
+  }
+  const ClosureTemplate& result = closure_templates_[non_terminal];
+  return result.order.empty() ? nullptr : &result;
+}
+
+void GrammarSet::compute_closure_templates() {
+  closure_templates_.assign(lhs_productions_.size(), ClosureTemplate());
+  const size_t words = (productions_->size() + 63) / 64;
+
+  for (size_t lhs = 0; lhs < lhs_productions_.size(); ++lhs) {
+    if (lhs_productions_[lhs].empty()) continue;
+
+    // 与 ItemSet::closure 的 DFS 完全相同的加入顺序
+    ClosureTemplate& result = closure_templates_[lhs];
+    result.bits.assign(words, 0);
+    std::vector<int> stk;
+    auto expand = [&](SymbolId symbol) {
+      for (int prod : productions_of(symbol)) {
+        uint64_t mask = uint64_t(1) << (prod % 64);
+        if (result.bits[prod / 64] & mask) continue;
+        result.bits[prod / 64] |= mask;
+        result.order.push_back(prod);
+        stk.push_back(prod);
+      }
+    };
+
+    expand(static_cast<SymbolId>(lhs));
+    while (!stk.empty()) {
+      int prod = stk.back();
+      stk.pop_back();
+      if (productions_->length(prod) > 0) {
+        expand((*productions_)[prod].rhs_ids()[0]);
+      }
+    }
+  }
+}
+
 void GrammarSet::compute_symbols() {
+  bind_symbols();
   terminals_.clear();
   non_terminals_.clear();
 
@@ -157,82 +284,146 @@ void GrammarSet::compute_symbols() {
   }
 }
 
-std::unordered_set<std::string> GrammarSet::compute_first(const std::string& symbol) {
-  if (first_.count(symbol)) {
-    return first_[symbol];
+void GrammarSet::compute_bits() {
+  compute_symbols();
+  const size_t symbol_count = symbols_->size();
+  auto is_non_terminal = [&](SymbolId id) { return !productions_of(id).empty(); };
+
+  // 终结符编号：# 与所有出现在右部的终结符，按符号 id 升序
+  terminal_index_.assign(symbol_count, -1);
+  terminal_ids_.clear();
+  for (SymbolId id = 0; id < static_cast<SymbolId>(symbol_count); ++id) {
+    if (id == SymbolInterner::EPSILON || is_non_terminal(id)) continue;
+    if (id != SymbolInterner::END && !terminals_.count(symbols_->name(id))) continue;
+    terminal_index_[id] = static_cast<int>(terminal_ids_.size());
+    terminal_ids_.push_back(id);
   }
-
-  if (in_progress_.count(symbol)) {
-    // 正在计算，检测到递归，返回空集合防止死循环
-    return {};
+  const size_t terminal_count = terminal_ids_.size();
+
+  // 1. nullable：每条产生式记录右部还有几个符号未确定可空，减到 0 时左部可空
+  nullable_.assign(symbol_count, false);
+  std::vector<int> pending(productions_->size(), 0);
+  std::vector<std::vector<int>> occurrences(symbol_count); // 符号 -> 出现在哪些产生式的右部
+  std::vector<SymbolId> queue;
+  auto mark_nullable = [&](SymbolId id) {
+    if (!nullable_[id]) {
+      nullable_[id] = true;
+      queue.push_back(id);
+    }
+  };
+  for (const auto& productions : lhs_productions_) {
+    for (int prod : productions) {
+      const size_t length = productions_->length(prod);
+      pending[prod] = static_cast<int>(length);
+      if (length == 0) mark_nullable((*productions_)[prod].lhs_id());
+      for (size_t i = 0; i < length; ++i) {
+        occurrences[(*productions_)[prod].rhs_ids()[i]].push_back(prod);
+      }
+    }
   }
-
-  in_progress_.insert(symbol); // 标记正在计算
-
-  std::unordered_set<std::string> result;
-
-  // 终结符：FIRST就是自己
-  if (terminals_.count(symbol)) {
-    result.insert(symbol);
-    first_[symbol] = result;
-    in_progress_.erase(symbol);
-    return result;
+  for (size_t head = 0; head < queue.size(); ++head) {
+    for (int prod : occurrences[queue[head]]) {
+      if (--pending[prod] == 0) mark_nullable((*productions_)[prod].lhs_id());
+    }
   }
 
-  // 非终结符
-  if (!grammars_.count(symbol)) {
-    // 防止万一symbol没定义
-    in_progress_.erase(symbol);
-    return {};
+  // 2. FIRST：A -> α X β 且 α 可空时，终结符 X 直接加入，非终结符 X 连一条 A -> X 的边
+  //    按强连通分量求传递闭包，左递归、互相递归的非终结符在同一分量内一起收敛
+  first_bits_.assign(symbol_count, bittool::make(terminal_count));
+  std::vector<std::vector<int>> first_edges(symbol_count);
+  for (SymbolId id : terminal_ids_) {
+    bittool::set(first_bits_[id], terminal_index_[id]);
   }
-
-  for (const auto& prod : grammars_.at(symbol)) {
-    const auto& rhs = prod.rhs();
-
-    if (rhs.empty() || (rhs.size() == 1 && rhs[0] == "ε")) {
-      // 空产生式
-      result.insert("ε");
-      continue;
-    }
-
-    bool all_nullable = true;
-    for (const auto& sym : rhs) {
-      auto sym_first = compute_first(sym);
-
-      for (const auto& f : sym_first) {
-        if (f != "ε") {
-          result.insert(f);
+  for (const auto& productions : lhs_productions_) {
+    for (int prod : productions) {
+      const Grammar& grammar = (*productions_)[prod];
+      for (size_t i = 0; i < productions_->length(prod); ++i) {
+        SymbolId x = grammar.rhs_ids()[i];
+        if (is_non_terminal(x)) {
+          first_edges[grammar.lhs_id()].push_back(x);
+        } else if (terminal_index_[x] >= 0) {
+          bittool::set(first_bits_[grammar.lhs_id()], terminal_index_[x]);
         }
-      }
-
-      if (sym_first.find("ε") == sym_first.end()) {
-        all_nullable = false;
-        break;
+        if (!nullable_[x]) break;
       }
     }
-
-    if (all_nullable) {
-      result.insert("ε");
+  }
+  bittool::digraph(first_edges, first_bits_);
+
+  // 3. FOLLOW：A -> α B β 时 FIRST(β) 加入 FOLLOW(B)，β 可空时连一条 B -> A 的边
+  follow_bits_.assign(symbol_count, bittool::make(terminal_count));
+  std::vector<std::vector<int>> follow_edges(symbol_count);
+  SymbolId start_id = start_.empty() ? NO_SYMBOL : symbols_->find(start_);
+  if (start_id != NO_SYMBOL) {
+    bittool::set(follow_bits_[start_id], terminal_index_[SymbolInterner::END]);
+  }
+  for (const auto& productions : lhs_productions_) {
+    for (int prod : productions) {
+      const Grammar& grammar = (*productions_)[prod];
+      const size_t length = productions_->length(prod);
+      for (size_t i = 0; i < length; ++i) {
+        SymbolId b = grammar.rhs_ids()[i];
+        if (!is_non_terminal(b)) continue;
+        bool rest_nullable = true;
+        for (size_t j = i + 1; j < length; ++j) {
+          SymbolId x = grammar.rhs_ids()[j];
+          bittool::merge(follow_bits_[b], first_bits_[x]);
+          if (!nullable_[x]) {
+            rest_nullable = false;
+            break;
+          }
+        }
+        if (rest_nullable && b != grammar.lhs_id()) {
+          follow_edges[b].push_back(grammar.lhs_id());
+        }
+      }
     }
   }
+  bittool::digraph(follow_edges, follow_bits_);
+}
 
-  first_[symbol] = result;
-  in_progress_.erase(symbol);
-  return result;
+bool GrammarSet::nullable(SymbolId symbol) const {
+  return symbol >= 0 && static_cast<size_t>(symbol) < nullable_.size() && nullable_[symbol];
+}
+
+const bittool::Bits& GrammarSet::first_bits(SymbolId symbol) const {
+  return first_bits_.at(symbol);
+}
+
+const bittool::Bits& GrammarSet::follow_bits(SymbolId symbol) const {
+  return follow_bits_.at(symbol);
+}
+
+int GrammarSet::terminal_index(SymbolId symbol) const {
+  if (symbol < 0 || static_cast<size_t>(symbol) >= terminal_index_.size()) return -1;
+  return terminal_index_[symbol];
+}
+
+std::unordered_set<std::string> GrammarSet::compute_first(const std::string& symbol) {
+  if (first_.empty()) {
+    compute_first();
+  }
+  auto it = first_.find(symbol);
+  return it == first_.end() ? std::unordered_set<std::string>() : it->second;
 }
 
 std::unordered_map<std::string, std::unordered_set<std::string>> GrammarSet::compute_first() {
   first_.clear();
-  compute_symbols();
+  compute_bits();
 
-  // 终结符：FIRST集合就是自己
+  // 由位集生成字符串形式：终结符为自身，非终结符可空时含 ε
   for (const auto& t : terminals_) {
     first_[t].insert(t);
   }
-
-  // 非终结符：递归计算
   for (const auto& nt : non_terminals_) {
-    compute_first(nt);
+    SymbolId id = symbols_->find(nt);
+    auto& result = first_[nt];
+    bittool::for_each(first_bits_[id], [&](size_t index) {
+      result.insert(symbols_->name(terminal_ids_[index]));
+    });
+    if (nullable_[id]) {
+      result.insert("ε");
+    }
   }
 
   return first_;
@@ -240,63 +431,28 @@ std::unordered_map<std::string, std::unordered_set<std::string>> GrammarSet::com
 
 std::unordered_map<std::string, std::unordered_set<std::string>> GrammarSet::compute_follow() {
   follow_.clear();
-  compute_symbols(); // 先确保 terminals_ 和 non_terminals_ 正确
-  compute_first();   // 确保 first_ 表正确
-
-  // 起始符号的 FOLLOW 集必须包含 #
-  follow_[start_].insert("#");
+  compute_first(); // 同时算好 FOLLOW 位集
 
-  bool changed;
-  do {
-    changed = false;
-    for (const auto& [lhs, productions] : grammars_) {
-      for (const auto& prod : productions) {
-        const auto& rhs = prod.rhs();
-
-        // 遍历产生式右部的每个符号
-        for (size_t i = 0; i < rhs.size(); ++i) {
-          const std::string& B = rhs[i];
-
-          // 只处理非终结符
-          if (non_terminals_.find(B) == non_terminals_.end()) continue;
-
-          bool nullable = true; // 记录右侧后续符号是否可推出ε
-
-          // 从 B 后面的每一个符号开始处理
-          for (size_t j = i + 1; j < rhs.size(); ++j) {
-            const auto& sym = rhs[j];
-
-            // 将 sym 的 FIRST 集中的非ε元素加入 FOLLOW(B)
-            for (const auto& f : first_[sym]) {
-              if (f != "ε" && follow_[B].insert(f).second) {
-                changed = true;
-              }
-            }
-
-            // 如果 sym 的 FIRST 集中不包含 ε，停止向后传递
-            if (first_[sym].find("ε") == first_[sym].end()) {
-              nullable = false;
-              break;
-            }
-          }
-
-          // 如果B后面所有符号都能推出ε，或者B已经是最后一个符号
-          // 把 FOLLOW(lhs) 加到 FOLLOW(B)
-          if (nullable || (i + 1 == rhs.size())) {
-            for (const auto& f : follow_[lhs]) {
-              if (follow_[B].insert(f).second) {
-                changed = true;
-              }
-            }
-          }
-        }
-      }
-    }
-  } while (changed); // 如果有变化，继续迭代
+  for (const auto& nt : non_terminals_) {
+    SymbolId id = symbols_->find(nt);
+    auto& result = follow_[nt];
+    bittool::for_each(follow_bits_[id], [&](size_t index) {
+      result.insert(symbols_->name(terminal_ids_[index]));
+    });
+  }
 
   return follow_;
 }
 
+const GrammarSet::Precedence* GrammarSet::precedence(const Grammar& grammar) const {
+  const auto& rhs = grammar.rhs();
+  for (auto it = rhs.rbegin(); it != rhs.rend(); ++it) {
+    auto found = precedences_.find(*it);
+    if (found != precedences_.end()) return &found->second;
+  }
+  return nullptr;
+}
+
 void GrammarSet::set_start(const std::string& start_symbol) {
   start_ = start_symbol;
 }
@@ -337,6 +493,30 @@ bool GrammarSet::parse_stream(std::istream& input) {
     line = trim(line);
     if (line.empty()) continue;
 
+    // 优先级声明：%left / %right / %nonassoc 后跟若干终结符，越靠后的行优先级越高
+    if (line[0] == '%') {
+      std::vector<std::string> words = split(line, ' ');
+      Associativity associativity;
+      if (words[0] == "%left") {
+        associativity = LEFT;
+      } else if (words[0] == "%right") {
+        associativity = RIGHT;
+      } else if (words[0] == "%nonassoc") {
+        associativity = NONASSOC;
+      } else {
+        std::cerr << "Invalid grammar line: " << line << " (unknown declaration)" << std::endl;
+        return false;
+      }
+      int level = 1;
+      for (const auto& [_, declared] : precedences_) {
+        level = std::max(level, declared.level + 1);
+      }
+      for (size_t i = 1; i < words.size(); ++i) {
+        if (!words[i].empty()) precedences_[words[i]] = {level, associativity};
+      }
+      continue;
+    }
+
     auto arrow_pos = line.find("->");
     if (arrow_pos == std::string::npos) {
       std::cerr << "Invalid grammar line: " << line << " (missing ->)" << std::endl;
@@ -390,6 +570,7 @@ bool GrammarSet::parse_stream(std::istream& input) {
     }
   }
 
+  bind_symbols();
   return true;
 }
 
@@ -3,10 +3,15 @@
 
 #include "utils/json.hpp"
 #include "utils/format.hpp"
+#include "symbol_interner.hpp"
+#include "utils/bittool.hpp"
+#include "utils/strtool.hpp"
 #include <string>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
+#include <deque>
+#include <memory>
 #include <sstream>
 #include <fstream>
 #include <iostream>
@@ -26,6 +31,10 @@ public:
   // 带左部和右部的构造函数
   Grammar(const std::string& lhs, const std::vector<std::string>& rhs);
 
+  // 带符号 id 的构造函数（id 与字符串一一对应）
+  Grammar(const std::string& lhs, const std::vector<std::string>& rhs,
+          SymbolId lhs_id, const std::vector<SymbolId>& rhs_ids);
+
   // 文法字符串的构造函数（如 "A -> B C D"）
   explicit Grammar(const std::string& grammar_text);
 
@@ -35,6 +44,21 @@ public:
   // 获取右部符号序列
   const std::vector<std::string>& rhs() const;
 
+  // 获取左部符号 id（未绑定时为 NO_SYMBOL）
+  SymbolId lhs_id() const { return lhs_id_; }
+
+  // 获取右部符号 id 序列（未绑定时为空）
+  const std::vector<SymbolId>& rhs_ids() const { return rhs_ids_; }
+
+  // 是否已绑定符号 id
+  bool bound() const { return lhs_id_ != NO_SYMBOL; }
+
+  // 在驻留表中登记所有符号并记录 id
+  void bind(SymbolInterner& symbols);
+
+  // 是否是空产生式（右部为空或只有 ε）
+  bool is_epsilon() const;
+
   // 转为 JSON 表示
   json to_json() const;
 
@@ -59,11 +83,61 @@ public:
 private:
   std::string lhs_; // 左部非终结符
   std::vector<std::string> rhs_; // 右部符号列表
+  SymbolId lhs_id_ = NO_SYMBOL; // 左部符号 id
+  std::vector<SymbolId> rhs_ids_; // 右部符号 id 列表
+};
+
+// 产生式表：为每条（已绑定符号 id 的）产生式分配稠密编号，只增不删
+// 项目只记录（产生式编号, 点位置），左部/右部都从这里取
+class ProductionTable {
+public:
+  explicit ProductionTable(SymbolInternerPtr symbols) : symbols_(std::move(symbols)) {}
+
+  // 登记产生式，返回编号；已登记的直接返回原编号
+  int intern(const Grammar& grammar);
+
+  // 查找编号，不存在时返回 -1
+  int find(const Grammar& grammar) const;
+
+  // 编号 -> 产生式（deque 存放，引用在登记新产生式后依然有效）
+  const Grammar& operator[](int id) const { return productions_[id]; }
+
+  // 右部长度，ε 产生式为 0
+  size_t length(int id) const { return lengths_[id]; }
+
+  // 已登记的产生式数
+  size_t size() const { return productions_.size(); }
+
+  // 产生式所用的符号驻留表
+  const SymbolInterner& symbols() const { return *symbols_; }
+
+private:
+  SymbolInternerPtr symbols_;
+  std::deque<Grammar> productions_;                           // id -> 产生式
+  std::vector<uint32_t> lengths_;                             // id -> 右部长度
+  std::unordered_map<Grammar, int, Grammar::Hash> ids_;       // 产生式 -> id
+};
+
+using ProductionTablePtr = std::shared_ptr<ProductionTable>;
+
+// 闭包模板：从某个非终结符出发（点在其前），求闭包能加入的全部产生式（点在最前）
+struct ClosureTemplate {
+  std::vector<int> order;       // 按 DFS 求闭包时的加入顺序
+  std::vector<uint64_t> bits;   // 同一组产生式的位集，按产生式编号
 };
 
 // 文法集合（多个产生式）
 class GrammarSet {
 public:
+  // 终结符的结合性
+  enum Associativity { LEFT, RIGHT, NONASSOC };
+
+  // 终结符的优先级：level 越大越优先
+  struct Precedence {
+    int level;
+    Associativity associativity;
+  };
+
   // 默认构造函数
   GrammarSet();
 
@@ -91,6 +165,12 @@ public:
   // 从文件解析文法(带起始符)
   bool parse_file(const std::string& filename, const std::string& start_symbol);
 
+  // 解析过的文法源文本的校验和（多次解析时累计）
+  uint64_t source_checksum() const { return checksum_; }
+
+  // 文法源文本/文件的校验和，与只解析一次该源时的 source_checksum() 相同，文件打不开时返回 0
+  static uint64_t checksum(const std::string& source);
+
   // 获取所有文法集合
   const std::unordered_map<std::string, std::vector<Grammar>>& grammars() const;
 
@@ -112,12 +192,35 @@ public:
   // 获取FIRST集合
   const std::unordered_map<std::string, std::unordered_set<std::string>>& first_set() const { return first_; }
 
+  // 获取符号驻留表（副本之间共享）
+  SymbolInterner& symbols() const { return *symbols_; }
+  const SymbolInternerPtr& symbols_ptr() const { return symbols_; }
+
+  // 获取产生式表（副本之间共享）
+  ProductionTable& productions() const { return *productions_; }
+
+  // 左部为 lhs 的所有产生式编号，顺序与 grammars() 中一致
+  // 通过非 const operator[] 修改文法后需要重新 bind_symbols()
+  const std::vector<int>& productions_of(SymbolId lhs) const;
+
+  // 非终结符的闭包模板（bind_symbols() 时预先算好），没有时返回 nullptr
+  const ClosureTemplate* closure_template(SymbolId non_terminal) const;
+
+  // 文法文件中 %left / %right / %nonassoc 声明的终结符优先级（后声明的更高）
+  const std::unordered_map<std::string, Precedence>& precedences() const { return precedences_; }
+
+  // 产生式的优先级：右部最后一个声明了优先级的终结符，没有时返回 nullptr
+  const Precedence* precedence(const Grammar& grammar) const;
+
   // 获取FOLLOW集合
   const std::unordered_map<std::string, std::unordered_set<std::string>>& follow_set() const { return follow_; }
 
-  // 计算终结符和变元
+  // 计算终结符和变元（同时为所有产生式绑定符号 id）
   void compute_symbols();
 
+  // 为所有产生式和起始符号绑定符号 id，并登记到产生式表
+  void bind_symbols();
+
   // 计算单个符号的FIRST
   std::unordered_set<std::string> compute_first(const std::string& symbol);
 
@@ -127,6 +230,21 @@ public:
   // 计算所有非终结符的 FOLLOW
   std::unordered_map<std::string, std::unordered_set<std::string>> compute_follow();
 
+  // 以位集计算 nullable / FIRST / FOLLOW（compute_first()/compute_follow() 会调用）
+  // 依赖图按强连通分量求传递闭包，在左递归、互相递归的文法上也是完整的
+  void compute_bits();
+
+  // 符号能否推出 ε
+  bool nullable(SymbolId symbol) const;
+
+  // FIRST/FOLLOW 位集，按终结符编号（终结符的 FIRST 为自身）
+  const bittool::Bits& first_bits(SymbolId symbol) const;
+  const bittool::Bits& follow_bits(SymbolId symbol) const;
+
+  // 终结符编号（# 和右部出现的终结符按 id 升序编号），不是终结符时返回 -1
+  int terminal_index(SymbolId symbol) const;
+  const std::vector<SymbolId>& terminal_ids() const { return terminal_ids_; }
+
   // 设置起始符号
   void set_start(const std::string& start_symbol);
 
@@ -141,12 +259,25 @@ public:
 
 private:
   std::string start_; // 起始文法符号
+  uint64_t checksum_ = strtool::fnv1a(""); // 文法源文本的校验和
   std::unordered_set<std::string> terminals_; // 终结符集合
   std::unordered_set<std::string> non_terminals_; // 非终结符集合
   std::unordered_map<std::string, std::unordered_set<std::string>> first_; // FIRST 集合
   std::unordered_map<std::string, std::unordered_set<std::string>> follow_; // FOLLOW 集合
   std::unordered_map<std::string, std::vector<Grammar>> grammars_; // 文法表，左部 -> 产生式列表
-  mutable std::unordered_set<std::string> in_progress_; // 计算 FIRST 时的中间状态
+  std::unordered_map<std::string, Precedence> precedences_; // 终结符 -> 优先级
+  std::vector<bool> nullable_; // 符号 id -> 能否推出 ε
+  std::vector<bittool::Bits> first_bits_; // 符号 id -> FIRST 位集
+  std::vector<bittool::Bits> follow_bits_; // 符号 id -> FOLLOW 位集
+  std::vector<int> terminal_index_; // 符号 id -> 终结符编号
+  std::vector<SymbolId> terminal_ids_; // 终结符编号 -> 符号 id
+  SymbolInternerPtr symbols_ = std::make_shared<SymbolInterner>(); // 符号驻留表
+  ProductionTablePtr productions_ = std::make_shared<ProductionTable>(symbols_); // 产生式表
+  std::vector<std::vector<int>> lhs_productions_; // 左部 id -> 产生式编号列表
+  std::vector<ClosureTemplate> closure_templates_; // 左部 id -> 闭包模板
+
+  // 为每个非终结符预先计算闭包模板
+  void compute_closure_templates();
 
   // 辅助函数：从输入流解析文法
   bool parse_stream(std::istream& input);
@@ -1,49 +1,47 @@
 #include "item.hpp"
 #include "utils/format.hpp"
+#include <algorithm>
 
 // ===== Item 类实现 =====
 
 Item::Item() = default;
 
-Item::Item(const Grammar &grammar, size_t pos)
-  : lhs_(grammar.lhs()), rhs_(insert_dot(grammar.rhs(), pos)) {}
+Item::Item(const ProductionTable& table, int production, size_t dot)
+  : table_(&table), production_(static_cast<uint32_t>(production)), dot_(static_cast<uint32_t>(dot)) {}
 
-const std::string &Item::lhs() const { return lhs_; }
+Item Item::advance() const {
+  Item moved = *this;
+  if (dot_ < table_->length(production_)) {
+    moved.dot_++;
+  }
+  return moved;
+}
+
+const std::string &Item::lhs() const { return grammar().lhs(); }
 
-const std::vector<std::string> &Item::rhs() const { return rhs_; }
+std::vector<std::string> Item::rhs() const { return insert_dot(grammar().rhs(), dot_); }
 
 bool Item::completed() const {
-  if (rhs_.empty()) return false;
-  // 遍历找到最后一个带点的符号
-  for (auto it = rhs_.rbegin(); it != rhs_.rend(); ++it) {
-    if (!it->empty() && (*it)[0] == '`') {
-      return (it == rhs_.rbegin());
-    }
-  }
-  return false;
+  // ε 产生式只有点在最前（即只有一个点）时算完成
+  return dot_ == table_->length(production_);
 }
 
 Grammar Item::to_grammar() const {
-  std::vector<std::string> clean_rhs;
-  for (const auto& symbol : rhs_) {
-    if (symbol != "`") {
-      clean_rhs.push_back(symbol);
-    }
-  }
-  if (clean_rhs.empty()) {
-    clean_rhs.push_back("ε"); // 如果右部是空，加上"ε"
+  const Grammar& prod = grammar();
+  if (prod.rhs().empty()) {
+    return Grammar(prod.lhs(), {"ε"}, prod.lhs_id(), {SymbolInterner::EPSILON}); // 如果右部是空，加上"ε"
   }
-  return Grammar(lhs_, clean_rhs);
+  return prod;
 }
 
 json Item::to_json() const {
-  return rhs_;
+  return rhs();
 }
 
 std::string Item::to_string() const {
   std::ostringstream oss;
-  oss << lhs_ << " ->";
-  for (const auto& sym : rhs_) {
+  oss << lhs() << " ->";
+  for (const auto& sym : rhs()) {
     if (sym == "`") oss << " \u2022";
     else oss << " " << sym;
   }
@@ -51,18 +49,22 @@ std::string Item::to_string() const {
 }
 
 bool Item::operator==(const Item &other) const {
-  return lhs_ == other.lhs_ && rhs_ == other.rhs_;
+  if (table_ == other.table_) {
+    return production_ == other.production_ && dot_ == other.dot_;
+  }
+  return lhs() == other.lhs() && rhs() == other.rhs();
 }
 
 std::ostream &operator<<(std::ostream &os, const Item &item) {
-  os << item.lhs_ << " -> ";
-  for (size_t i = 0; i < item.rhs_.size(); ++i) {
-    if (item.rhs_[i] == "`") {
+  const auto rhs = item.rhs();
+  os << item.lhs() << " -> ";
+  for (size_t i = 0; i < rhs.size(); ++i) {
+    if (rhs[i] == "`") {
       os << "\u2022";
     } else {
-      os << item.rhs_[i];
+      os << rhs[i];
     }
-    if (i != item.rhs_.size() - 1) {
+    if (i != rhs.size() - 1) {
       os << " ";
     }
   }
@@ -99,55 +101,61 @@ std::vector<std::string> Item::insert_dot(const std::vector<std::string> &rhs, s
 // 默认构造
 ItemSet::ItemSet() = default;
 
-ItemSet::ItemSet(const Grammar& grammar, size_t pos) {
-  add(grammar, pos);
-}
-
 ItemSet::ItemSet(const Item& item) {
   add(item);
 }
 
 ItemSet::ItemSet(const GrammarSet& grammar_set, size_t pos) {
+  ProductionTable& table = grammar_set.productions();
   for (const auto& [lhs, grammar_list] : grammar_set.grammars()) {
     for (const auto& grammar : grammar_list) {
-      add(grammar, pos);
+      if (grammar.bound()) {
+        add(Item(table, table.intern(grammar), pos));
+      } else {
+        Grammar bound = grammar;
+        bound.bind(grammar_set.symbols());
+        add(Item(table, table.intern(bound), pos));
+      }
     }
   }
 }
 
 void ItemSet::add(const Item &item) {
-  items_[item.lhs()].push_back(item);
-}
-
-void ItemSet::add(const Grammar &grammar, size_t pos) {
-  Item item(grammar, pos);
-  add(item);
+  if (symbols_ == nullptr) {
+    // 第一个项目决定分组所用的驻留表
+    symbols_ = &item.table_->symbols();
+    items_ = ItemMap(0, SymbolNameHash{symbols_});
+  }
+  items_[item.lhs_id()].push_back(item);
 }
 
-const std::unordered_map<std::string, std::vector<Item>> &ItemSet::items() const {
+const ItemSet::ItemMap &ItemSet::items() const {
   return items_;
 }
 
-std::vector<Item> &ItemSet::operator[](const std::string &lhs) {
-  return items_[lhs];
-}
-
 const std::vector<Item> &ItemSet::operator[](const std::string &lhs) const {
-  auto it = items_.find(lhs);
+  static const std::vector<Item> empty;
+  if (symbols_ == nullptr) {
+    return empty;
+  }
+  SymbolId id = symbols_->find(lhs);
+  auto it = id == NO_SYMBOL ? items_.end() : items_.find(id);
   if (it == items_.end()) {
-    static const std::vector<Item> empty;
     return empty;
   }
   return it->second;
 }
 
 bool ItemSet::contains(const Item &item) const {
+  if (items_.empty()) {
+    return false;
+  }
   // items_为哈希表, 以O(1)复杂度搜索item的左部
-  auto it = items_.find(item.lhs());
+  auto it = items_.find(item.lhs_id());
   if (it == items_.end()) {
     return false;
   }
-  // 依次判断item的右部是否在项目集中
+  // 同一左部下逐个比较（产生式编号, 点位置）
   const auto &item_list = it->second;
   for (const auto &existing_item : item_list) {
     if (existing_item == item) {
@@ -170,19 +178,8 @@ ItemSet ItemSet::move() const {
   ItemSet moved_set;
   for (const auto& [lhs, item_list] : items_) {
     for (const auto& item : item_list) {
-      const auto& rhs = item.rhs();
-      auto it = std::find(rhs.begin(), rhs.end(), "`");
-      if (it != rhs.end() && (it + 1) != rhs.end()) {
-        size_t dot_pos = std::distance(rhs.begin(), it);
-
-        std::vector<std::string> real_rhs;
-        for (const auto& sym : rhs) {
-          if (sym != "`") {
-            real_rhs.push_back(sym);
-          }
-        }
-        Item moved_item(Grammar(item.lhs(), real_rhs), dot_pos + 1);
-        moved_set.add(moved_item);
+      if (item.next_symbol_id() != NO_SYMBOL) {
+        moved_set.add(item.advance());
       }
     }
   }
@@ -190,22 +187,19 @@ ItemSet ItemSet::move() const {
 }
 
 ItemSet ItemSet::move(const std::string& symbol) const {
+  if (symbols_ == nullptr) {
+    return ItemSet();
+  }
+  SymbolId id = symbols_->find(symbol);
+  return id == NO_SYMBOL ? ItemSet() : move(id);
+}
+
+ItemSet ItemSet::move(SymbolId symbol) const {
   ItemSet moved_set;
   for (const auto& [lhs, item_list] : items_) {
     for (const auto& item : item_list) {
-      const auto& rhs = item.rhs();
-      auto it = std::find(rhs.begin(), rhs.end(), "`");
-      if (it != rhs.end() && (it + 1) != rhs.end() && *(it + 1) == symbol) {
-        size_t dot_pos = std::distance(rhs.begin(), it);
-
-        std::vector<std::string> real_rhs;
-        for (const auto& sym : rhs) {
-          if (sym != "`") {
-            real_rhs.push_back(sym);
-          }
-        }
-        Item moved_item(Grammar(item.lhs(), real_rhs), dot_pos + 1);
-        moved_set.add(moved_item);
+      if (item.next_symbol_id() == symbol) {
+        moved_set.add(item.advance());
       }
     }
   }
@@ -216,10 +210,22 @@ std::unordered_set<std::string> ItemSet::next_symbols() const {
   std::unordered_set<std::string> symbols;
   for (const auto& [lhs, item_list] : items_) {
     for (const auto& item : item_list) {
-      const auto& rhs = item.rhs();
-      auto it = std::find(rhs.begin(), rhs.end(), "`");
-      if (it != rhs.end() && (it + 1) != rhs.end()) {
-        symbols.insert(*(it + 1));
+      SymbolId next = item.next_symbol_id();
+      if (next != NO_SYMBOL) {
+        symbols.insert(symbols_->name(next));
+      }
+    }
+  }
+  return symbols;
+}
+
+std::unordered_set<SymbolId, SymbolNameHash> ItemSet::next_symbol_ids() const {
+  std::unordered_set<SymbolId, SymbolNameHash> symbols(0, SymbolNameHash{symbols_});
+  for (const auto& [lhs, item_list] : items_) {
+    for (const auto& item : item_list) {
+      SymbolId next = item.next_symbol_id();
+      if (next != NO_SYMBOL) {
+        symbols.insert(next);
       }
     }
   }
@@ -231,40 +237,68 @@ ItemSet ItemSet::closure(const GrammarSet &grammar_set) const {
 }
 
 ItemSet ItemSet::closure(const Item &item, const GrammarSet &grammar_set) {
-  ItemSet closure_set;
-  std::stack<Item> stk;
+  return closure(ItemSet(item), grammar_set);
+}
 
-  closure_set.add(item);
-  stk.push(item);
+ItemSet ItemSet::closure(const ItemSet &item_set, const GrammarSet &grammar_set) {
+  // 核中有点在最前的文法产生式时，模板之间会互相影响加入顺序，退回逐项 DFS
+  for (const auto &[lhs, item_list] : item_set.items_) {
+    for (const auto &item : item_list) {
+      if (item.dot() == 0 && !grammar_set.productions_of(item.lhs_id()).empty()) {
+        return closure_dfs(item_set, grammar_set);
+      }
+    }
+  }
 
-  while (!stk.empty()) {
-    Item current_item = stk.top();
-    stk.pop();
+  ItemSet closure_set;
+  const ProductionTable& table = grammar_set.productions();
+  std::vector<const ClosureTemplate*> templates;
 
-    const auto &rhs = current_item.rhs();
-    auto it = std::find(rhs.begin(), rhs.end(), "`");
+  // 核中所有项目先加入闭包集
+  for (const auto &[lhs, item_list] : item_set.items_) {
+    for (const auto &item : item_list) {
+      closure_set.add(item);
+      SymbolId next_symbol = item.next_symbol_id();
+      const ClosureTemplate* tpl = grammar_set.closure_template(next_symbol);
+      if (tpl == nullptr && !grammar_set.productions_of(next_symbol).empty()) {
+        // 文法改动后模板尚未重新计算
+        return closure_dfs(item_set, grammar_set);
+      }
+      templates.push_back(tpl);
+    }
+  }
 
-    if (it != rhs.end() && (it + 1) != rhs.end()) {
-      std::string next_symbol = *(it + 1);
+  // DFS 按栈的顺序从最后一个核项目开始展开，已加入的产生式连同其闭包都会被跳过，
+  // 所以依次合并各模板（去掉已有的产生式）得到的加入顺序与逐项 DFS 相同
+  std::vector<uint64_t> present((table.size() + 63) / 64, 0);
+  for (auto it = templates.rbegin(); it != templates.rend(); ++it) {
+    const ClosureTemplate* tpl = *it;
+    if (tpl == nullptr) continue;
 
-      if (grammar_set.grammars().count(next_symbol)) {
-        const auto &production_list = grammar_set.grammars().at(next_symbol);
-        for (const auto &prod : production_list) {
-          Item new_item(prod, 0);
-          if (!closure_set.contains(new_item)) {
-            closure_set.add(new_item);
-            stk.push(new_item);
-          }
-        }
+    // 模板已被完全包含时整体跳过
+    bool covered = true;
+    for (size_t w = 0; w < tpl->bits.size(); ++w) {
+      if (tpl->bits[w] & ~present[w]) {
+        covered = false;
+        break;
       }
     }
+    if (covered) continue;
+
+    for (int prod : tpl->order) {
+      uint64_t mask = uint64_t(1) << (prod % 64);
+      if (present[prod / 64] & mask) continue;
+      present[prod / 64] |= mask;
+      closure_set.add(Item(table, prod, 0));
+    }
   }
 
   return closure_set;
 }
 
-ItemSet ItemSet::closure(const ItemSet &item_set, const GrammarSet &grammar_set) {
+ItemSet ItemSet::closure_dfs(const ItemSet &item_set, const GrammarSet &grammar_set) {
   ItemSet closure_set;
+  const ProductionTable& table = grammar_set.productions();
   // 维护一个栈, 以实现DFS
   std::stack<Item> stk;
 
@@ -281,27 +315,20 @@ ItemSet ItemSet::closure(const ItemSet &item_set, const GrammarSet &grammar_set)
     Item current_item = stk.top();
     stk.pop();
 
-    // 文法的右部
-    const auto &rhs = current_item.rhs();
-    // 找到点的位置
-    auto it = std::find(rhs.begin(), rhs.end(), "`");
-
-    // 如果点后还有符号
-    if (it != rhs.end() && (it + 1) != rhs.end()) {
-      std::string next_symbol = *(it + 1);
-
-      // 如果这个符号有产生式
-      if (grammar_set.grammars().count(next_symbol)) {
-        const auto &production_list = grammar_set.grammars().at(next_symbol);
-        for (const auto &prod : production_list) {
-          // 根据产生式, 构造一个点在最左边位置的项目
-          Item new_item(prod, 0);
-          // 如果结果闭包集里不包含这个项目, 则加入闭包集和 stk
-          if (!closure_set.contains(new_item)) {
-            closure_set.add(new_item);
-            stk.push(new_item);
-          }
-        }
+    // 点后的符号，没有则跳过
+    SymbolId next_symbol = current_item.next_symbol_id();
+    if (next_symbol == NO_SYMBOL) {
+      continue;
+    }
+
+    // 如果这个符号有产生式
+    for (int prod : grammar_set.productions_of(next_symbol)) {
+      // 根据产生式, 构造一个点在最左边位置的项目
+      Item new_item(table, prod, 0);
+      // 如果结果闭包集里不包含这个项目, 则加入闭包集和 stk
+      if (!closure_set.contains(new_item)) {
+        closure_set.add(new_item);
+        stk.push(new_item);
       }
     }
   }
@@ -326,7 +353,7 @@ json ItemSet::to_json() const {
     for (const auto &item : item_list) {
       productions.push_back(item.to_json());
     }
-    result[lhs] = productions;
+    result[symbols_->name(lhs)] = productions;
   }
   return result;
 }
@@ -383,6 +410,17 @@ bool ItemSet::operator==(const ItemSet& other) const {
   return true;
 }
 
+std::vector<uint64_t> ItemSet::canonical_key() const {
+  std::vector<uint64_t> key;
+  for (const auto& [lhs, item_list] : items_) {
+    for (const auto& item : item_list) {
+      key.push_back(item.key());
+    }
+  }
+  std::sort(key.begin(), key.end());
+  return key;
+}
+
 // ===== ItemCluster 类实现 =====
 
 ItemCluster::ItemCluster(const GrammarSet& grammar_set)
@@ -396,17 +434,14 @@ std::string ItemCluster::add(const ItemSet& kernel) {
   new_state.closure = kernel.closure(grammar_set_);
 
   states_[name] = new_state;
+  kernel_index_.emplace(kernel.canonical_key(), name);
 
   return name;
 }
 
-std::string ItemCluster::find(const ItemSet& item_set) const {
-  for (const auto& [name, state] : states_) {
-    if (state.closure == item_set) {
-      return name;
-    }
-  }
-  return "";
+std::string ItemCluster::find(const ItemSet& kernel) const {
+  auto it = kernel_index_.find(kernel.canonical_key());
+  return it == kernel_index_.end() ? "" : it->second;
 }
 
 const GrammarSet & ItemCluster::grammar_set() const {
@@ -439,6 +474,7 @@ void ItemCluster::parse_stream(const std::string& content) {
   }
 
   states_.clear();
+  kernel_index_.clear();
   state_counter_ = 0;
 
   for (const auto& [state_name, state_data] : j.items()) {
@@ -448,7 +484,8 @@ void ItemCluster::parse_stream(const std::string& content) {
       for (const auto& [lhs, rhs_list] : state_data["Kernel"].items()) {
         for (const auto& rhs : rhs_list) {
           Grammar g(lhs, rhs.get<std::vector<std::string>>());
-          state.kernel.add(g, 0);
+          g.bind(grammar_set_.symbols());
+          state.kernel.add(Item(grammar_set_.productions(), grammar_set_.productions().intern(g), 0));
         }
       }
     }
@@ -457,7 +494,8 @@ void ItemCluster::parse_stream(const std::string& content) {
       for (const auto& [lhs, rhs_list] : state_data["Closure"].items()) {
         for (const auto& rhs : rhs_list) {
           Grammar g(lhs, rhs.get<std::vector<std::string>>());
-          state.closure.add(g, 0);
+          g.bind(grammar_set_.symbols());
+          state.closure.add(Item(grammar_set_.productions(), grammar_set_.productions().intern(g), 0));
         }
       }
     }
@@ -469,6 +507,7 @@ void ItemCluster::parse_stream(const std::string& content) {
     }
 
     states_[state_name] = state;
+    kernel_index_.emplace(state.kernel.canonical_key(), state_name);
 
     if (state_name.find("Item Set ") == 0) {
       int num = std::stoi(state_name.substr(9));
@@ -512,50 +551,52 @@ void ItemCluster::parse_file(const std::string &filename) {
 
 void ItemCluster::build() {
   // 创建初始项目 [S' -> • S]
+  grammar_set_.bind_symbols();
   std::string start_symbol = grammar_set_.start_symbol();
   Grammar start_grammar(start_symbol + "'", {start_symbol});
-  Item start_item(start_grammar, 0);
+  start_grammar.bind(grammar_set_.symbols());
+  Item start_item(grammar_set_.productions(), grammar_set_.productions().intern(start_grammar), 0);
 
   // 清空现有状态
   states_.clear();
+  kernel_index_.clear();
   state_counter_ = 0;
 
   // 添加初始项
-  add(start_item);
-
-  std::unordered_set<std::string> processed;
-
-  bool changed = true;
-  while (changed) {
-    changed = false;
+  std::string start_name = add(start_item);
 
-    // 注意：复制一份当前 states 列表
-    auto current_states = states_;
+  // 工作表：每个状态只处理一次，按轮推进
+  // 同一轮内按 states_ 的遍历顺序处理，与逐轮复制 states_ 再遍历的旧实现顺序一致，状态编号保持不变
+  std::vector<std::string> worklist = {start_name};
+  while (!worklist.empty()) {
+    std::vector<std::string> created; // 本轮新建的状态
 
-    for (const auto& [state_name, state] : current_states) {
-      if (processed.count(state_name)) continue; // 跳过已处理
-
-      processed.insert(state_name); // 标记为已处理
+    for (const auto& state_name : worklist) {
+      // unordered_map 插入不会使已有元素的引用失效
+      const State& state = states_.at(state_name);
 
       // 遍历 closure 中每个 next symbol
-      for (const auto& symbol : state.closure.next_symbols()) {
+      for (SymbolId symbol : state.closure.next_symbol_ids()) {
         ItemSet moved_kernel = state.closure.move(symbol);
         if (moved_kernel.empty()) continue;
 
-        ItemSet closure_set = moved_kernel.closure(grammar_set_);
-
-        std::string existing = find(closure_set);
-        std::string target_name;
-
-        if (existing.empty()) {
+        // 按核查找，只有新状态才求闭包
+        std::string target_name = find(moved_kernel);
+        if (target_name.empty()) {
           target_name = add(moved_kernel);
-        } else {
-          target_name = existing;
+          created.push_back(target_name);
         }
 
-        set_goto(state_name, symbol, target_name);
+        set_goto(state_name, grammar_set_.symbols().name(symbol), target_name);
+      }
+    }
 
-        changed = true;
+    // 下一轮按 states_ 的遍历顺序处理本轮新建的状态
+    worklist.clear();
+    if (!created.empty()) {
+      std::unordered_set<std::string> fresh(created.begin(), created.end());
+      for (const auto& [name, _] : states_) {
+        if (fresh.count(name)) worklist.push_back(name);
       }
     }
   }
@@ -679,7 +720,7 @@ void ItemCluster::to_dot(const std::string& filename) const {
 
     for (const auto& [lhs, item_list] : state.closure.items()) {
       for (const auto& item : item_list) {
-        label << lhs << " ->";
+        label << item.lhs() << " ->";
         for (const auto& sym : item.rhs()) {
           if (sym == "`")
             label << " \u2022"; // 点 •
@@ -10,26 +10,50 @@
 #include <iostream>
 
 // 单个项目（Item）
+// 紧凑表示：（产生式编号, 点位置），产生式本身存放在所属 GrammarSet 的产生式表中
 class Item {
 public:
   // 默认构造函数
   Item();
 
-  // 从 Grammar 生成 Item，并插入点位
-  Item(const Grammar &grammar, size_t pos);
+  // 由产生式表中的第 production 条产生式和点位置构造
+  Item(const ProductionTable& table, int production, size_t dot);
 
   // 获取左部
   const std::string &lhs() const;
 
-  // 获取右部
-  const std::vector<std::string> &rhs() const;
+  // 获取右部（带点，按需生成）
+  std::vector<std::string> rhs() const;
+
+  // 获取左部符号 id
+  SymbolId lhs_id() const { return grammar().lhs_id(); }
+
+  // 产生式编号
+  int production() const { return static_cast<int>(production_); }
+
+  // 点的位置（不计 ε）
+  size_t dot() const { return dot_; }
+
+  // 点后的符号 id，点在末尾时为 NO_SYMBOL
+  SymbolId next_symbol_id() const {
+    return dot_ < table_->length(production_) ? grammar().rhs_ids()[dot_] : NO_SYMBOL;
+  }
+
+  // 点向右移动一格后的项目
+  Item advance() const;
 
   // 判断当前项目是否完成（点是否在末尾）
   bool completed() const;
 
+  // 对应的产生式
+  const Grammar& grammar() const { return (*table_)[production_]; }
+
   // 转换为对应的Grammar（去掉点）
   Grammar to_grammar() const;
 
+  // 打包成一个整数（产生式编号在高 32 位），同一产生式表内唯一
+  uint64_t key() const { return (static_cast<uint64_t>(production_) << 32) | dot_; }
+
   // 转为 JSON 表示
   json to_json() const;
 
@@ -43,23 +67,26 @@ public:
   friend std::ostream &operator<<(std::ostream &os, const Item &item);
 
 private:
-  std::string lhs_; // 左部符号
-  std::vector<std::string> rhs_; // 右部符号序列（带点）
+  friend class ItemSet;
+
+  const ProductionTable* table_ = nullptr; // 所属产生式表
+  uint32_t production_ = 0; // 产生式编号
+  uint32_t dot_ = 0; // 点的位置
 
   // 在指定位置插入点
   static std::vector<std::string> insert_dot(const std::vector<std::string> &rhs, size_t pos);
 };
 
 // 项目集（ItemSet）
+// 按左部分组存放紧凑项目；分组以左部 id 为键、按符号名哈希，遍历顺序与以左部名字为键时一致
 class ItemSet {
 public:
+  using ItemMap = std::unordered_map<SymbolId, std::vector<Item>, SymbolNameHash>;
+
   // 默认构造函数
   ItemSet();
 
-  // 从 Grammar 和 dot 位置构造
-  ItemSet(const Grammar& grammar, size_t pos);
-
-  // 从 GrammarSet 构造（所有产生式，点在最前）
+  // 从 GrammarSet 构造（所有产生式，点在 pos）
   ItemSet(const GrammarSet& grammar_set, size_t pos = 0);
 
   // 从单个 Item 构造
@@ -68,16 +95,10 @@ public:
   // 添加一个 Item
   void add(const Item &item);
 
-  // 从 Grammar 添加一个 Item
-  void add(const Grammar &grammar, size_t pos);
-
-  // 获取所有 Item
-  const std::unordered_map<std::string, std::vector<Item>> &items() const;
-
-  // 非 const 访问
-  std::vector<Item> &operator[](const std::string &lhs);
+  // 获取所有 Item（左部 id -> 项列表）
+  const ItemMap &items() const;
 
-  // const 访问
+  // 按左部名字访问
   const std::vector<Item> &operator[](const std::string &lhs) const;
 
   // 判断是否包含某个 Item
@@ -91,19 +112,26 @@ public:
 
   // 只移动点后是指定symbol的Item，返回新的ItemSet
   ItemSet move(const std::string& symbol) const;
+  ItemSet move(SymbolId symbol) const;
 
   // 获取所有Item点后面的下一个符号集合
   std::unordered_set<std::string> next_symbols() const;
 
+  // 按符号 id 获取，遍历顺序与 next_symbols() 一致
+  std::unordered_set<SymbolId, SymbolNameHash> next_symbol_ids() const;
+
   // 求自身闭包
   ItemSet closure(const GrammarSet &grammar_set) const;
 
   // 求单个 Item 的闭包
   static ItemSet closure(const Item &item, const GrammarSet &grammar_set);
 
-  // 求整个 ItemSet 的闭包
+  // 求整个 ItemSet 的闭包（合并 GrammarSet 预先算好的闭包模板）
   static ItemSet closure(const ItemSet &item_set, const GrammarSet &grammar_set);
 
+  // 逐项 DFS 求闭包，不使用闭包模板（结果与 closure 相同，用于对照）
+  static ItemSet closure_dfs(const ItemSet &item_set, const GrammarSet &grammar_set);
+
   // 求并集
   void union_set(const ItemSet &other);
 
@@ -122,8 +150,23 @@ public:
   // 判断两个 ItemSet 是否相同
   bool operator==(const ItemSet& other) const;
 
+  // 规范键：所有项目打包后排序，与项目顺序无关，用于按核查找状态
+  std::vector<uint64_t> canonical_key() const;
+
+  // 规范键的哈希
+  struct KeyHash {
+    size_t operator()(const std::vector<uint64_t>& key) const {
+      size_t h = key.size();
+      for (uint64_t v : key) {
+        h ^= std::hash<uint64_t>{}(v) + 0x9e3779b9 + (h << 6) + (h >> 2);
+      }
+      return h;
+    }
+  };
+
 private:
-  std::unordered_map<std::string, std::vector<Item>> items_; // 项目集，左部 -> 项列表
+  ItemMap items_; // 项目集，左部 id -> 项列表
+  const SymbolInterner* symbols_ = nullptr; // 左部 id 所属的驻留表（加入第一个项目时确定）
 };
 
 // 项目集簇（DFA的状态集合）
@@ -182,6 +225,7 @@ public:
 
 private:
   std::unordered_map<std::string, State> states_; // 状态集，名称->State
+  std::unordered_map<std::vector<uint64_t>, std::string, ItemSet::KeyHash> kernel_index_; // 核的规范键 -> 状态名称
   GrammarSet grammar_set_; // 当前使用的文法集
   int state_counter_; // 状态编号计数器，用于生成"Item Set N"
 
@@ -191,8 +235,8 @@ private:
   std::string generate_state_name();
   // 添加一个新的kernel（自动求closure）
   std::string add(const ItemSet& kernel);
-  // 查找是否已有某个 ItemSet（根据 closure 比较）
-  std::string find(const ItemSet& item_set) const;
+  // 查找是否已有核相同的状态（哈希索引，与核中项目顺序无关）
+  std::string find(const ItemSet& kernel) const;
   // 设置某个状态的转移
   void set_goto(const std::string& from_state, const std::string& symbol, const std::string& to_state);
 };
@@ -0,0 +1,124 @@
+#include "lalr.hpp"
+#include "utils/bittool.hpp"
+
+LALRLookahead::LALRLookahead(const ItemCluster& cluster) : grammar_set_(cluster.grammar_set()) {
+  grammar_set_.compute_bits();
+  const SymbolInterner& symbols = grammar_set_.symbols();
+
+  // 状态编号与转移
+  for (const auto& [name, state] : cluster.states()) {
+    state_index_.emplace(name, static_cast<int>(state_index_.size()));
+  }
+  goto_.resize(state_index_.size());
+  for (const auto& [name, state] : cluster.states()) {
+    auto& row = goto_[state_index_.at(name)];
+    for (const auto& [symbol, target] : state.goto_table) {
+      row[symbols.find(symbol)] = state_index_.at(target);
+    }
+  }
+
+  compute_transitions();
+}
+
+const std::vector<SymbolId>& LALRLookahead::lookahead(const std::string& state, int production) const {
+  static const std::vector<SymbolId> empty;
+  auto state_it = state_index_.find(state);
+  if (state_it == state_index_.end()) return empty;
+  auto it = lookahead_.find(key(state_it->second, production));
+  return it == lookahead_.end() ? empty : it->second;
+}
+
+int LALRLookahead::walk(int state, const std::vector<SymbolId>& symbols, size_t begin, size_t end) const {
+  for (size_t i = begin; i < end && state >= 0; ++i) {
+    auto it = goto_[state].find(symbols[i]);
+    state = it == goto_[state].end() ? -1 : it->second;
+  }
+  return state;
+}
+
+void LALRLookahead::compute_transitions() {
+  const SymbolInterner& symbols = grammar_set_.symbols();
+  const ProductionTable& table = grammar_set_.productions();
+  auto is_non_terminal = [&](SymbolId id) { return !grammar_set_.productions_of(id).empty(); };
+
+  // 1. 非终结符转移
+  for (int p = 0; p < static_cast<int>(goto_.size()); ++p) {
+    for (const auto& [symbol, target] : goto_[p]) {
+      if (is_non_terminal(symbol)) {
+        transition_index_.emplace(key(p, symbol), static_cast<int>(transitions_.size()));
+        transitions_.emplace_back(p, symbol);
+      }
+    }
+  }
+
+  // 2. DR 与 reads（位集按终结符编号）
+  const size_t terminal_count = grammar_set_.terminal_ids().size();
+  std::vector<bittool::Bits> sets(transitions_.size(), bittool::make(terminal_count));
+  std::vector<std::vector<int>> reads(transitions_.size());
+
+  auto start_it = state_index_.find("Item Set 0");
+  const int start_state = start_it == state_index_.end() ? -1 : start_it->second;
+  const SymbolId start_symbol = symbols.find(grammar_set_.start_symbol());
+
+  for (size_t t = 0; t < transitions_.size(); ++t) {
+    const auto& [p, symbol] = transitions_[t];
+    int r = goto_[p].at(symbol);
+    for (const auto& [next, _] : goto_[r]) {
+      if (!is_non_terminal(next)) {
+        if (grammar_set_.terminal_index(next) >= 0) bittool::set(sets[t], grammar_set_.terminal_index(next));
+      } else if (grammar_set_.nullable(next)) {
+        reads[t].push_back(transition_index_.at(key(r, next)));
+      }
+    }
+    // S' -> S • 之后只能是 #
+    if (p == start_state && symbol == start_symbol) {
+      bittool::set(sets[t], grammar_set_.terminal_index(SymbolInterner::END));
+    }
+  }
+
+  // 3. Read
+  bittool::digraph(reads, sets);
+
+  // 4. includes 与 lookback
+  std::vector<std::vector<int>> includes(transitions_.size());
+  for (size_t t = 0; t < transitions_.size(); ++t) {
+    const auto& [p, lhs] = transitions_[t];
+    for (int prod : grammar_set_.productions_of(lhs)) {
+      const std::vector<SymbolId>& rhs = table[prod].rhs_ids();
+      const size_t length = table.length(prod);
+
+      // suffix_nullable[i]：rhs[i..] 能否推出 ε
+      std::vector<bool> suffix_nullable(length + 1, true);
+      for (size_t i = length; i-- > 0;) {
+        suffix_nullable[i] = suffix_nullable[i + 1] && grammar_set_.nullable(rhs[i]);
+      }
+
+      int r = p;
+      for (size_t i = 0; i < length && r >= 0; ++i) {
+        if (is_non_terminal(rhs[i]) && suffix_nullable[i + 1]) {
+          auto it = transition_index_.find(key(r, rhs[i]));
+          if (it != transition_index_.end()) {
+            includes[it->second].push_back(static_cast<int>(t));
+          }
+        }
+        r = walk(r, rhs, i, i + 1);
+      }
+      if (r >= 0) {
+        lookback_[key(r, prod)].push_back(static_cast<int>(t));
+      }
+    }
+  }
+
+  // 5. Follow
+  bittool::digraph(includes, sets);
+
+  // 6. LA
+  for (const auto& [item_key, sources] : lookback_) {
+    bittool::Bits la = bittool::make(terminal_count);
+    for (int t : sources) {
+      bittool::merge(la, sets[t]);
+    }
+    std::vector<SymbolId>& result = lookahead_[item_key];
+    bittool::for_each(la, [&](size_t index) { result.push_back(grammar_set_.terminal_ids()[index]); });
+  }
+}
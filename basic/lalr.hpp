@@ -0,0 +1,47 @@
+#ifndef LALR_HPP
+#define LALR_HPP
+
+#include "item.hpp"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// LALR(1) 向前看符号
+// 在 ItemCluster 的 LR(0) 自动机上按 DeRemer–Pennello 方法计算：
+//   DR(p,A)     = { t | goto(goto(p,A), t) 存在 }，起始状态在起始符号上的转移另含 #
+//   Read(p,A)   = DR(p,A) ∪ ⋃{ Read(r,C) | (p,A) reads (r,C) }
+//   Follow(p,A) = Read(p,A) ∪ ⋃{ Follow(p',B) | (p,A) includes (p',B) }
+//   LA(q,A→ω)   = ⋃{ Follow(p,A) | (q,A→ω) lookback (p,A) }
+class LALRLookahead {
+public:
+  // 在已 build() 的 ItemCluster 上计算
+  explicit LALRLookahead(const ItemCluster& cluster);
+
+  // 状态 state 中按产生式 production（产生式表编号）归约时的向前看符号，按符号 id 升序
+  const std::vector<SymbolId>& lookahead(const std::string& state, int production) const;
+
+  // 非终结符转移数
+  size_t transition_count() const { return transitions_.size(); }
+
+private:
+  GrammarSet grammar_set_; // 与 cluster 的文法集共享符号表和产生式表
+  std::unordered_map<std::string, int> state_index_;          // 状态名 -> 下标
+  std::vector<std::unordered_map<SymbolId, int>> goto_;       // 下标 -> (符号 id -> 目标下标)
+
+  std::vector<std::pair<int, SymbolId>> transitions_;         // 非终结符转移 (p, A)
+  std::unordered_map<uint64_t, int> transition_index_;        // (p, A) -> 转移下标
+  std::unordered_map<uint64_t, std::vector<int>> lookback_;   // (q, 产生式) -> 转移下标列表
+  std::unordered_map<uint64_t, std::vector<SymbolId>> lookahead_; // (q, 产生式) -> 向前看符号
+
+  static uint64_t key(int first, int second) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(first)) << 32) | static_cast<uint32_t>(second);
+  }
+
+  // 从状态 state 出发依次读入 symbols，返回到达的状态，不存在时返回 -1
+  int walk(int state, const std::vector<SymbolId>& symbols, size_t begin, size_t end) const;
+
+  void compute_transitions();
+};
+
+#endif // LALR_HPP
@@ -5,6 +5,9 @@
 #include <regex>
 #include <iostream>
 #include <filesystem>
+#include <algorithm>
+#include <climits>
+#include <cstdio>
 
 using json = nlohmann::json;
 
@@ -38,44 +41,202 @@ void Lexical::parse_file(const std::string &file) {
   parse_stream(buffer.str());
 }
 
-std::vector<Lexical::Token> Lexical::analyze(const std::string& input) {
-  std::string source;
+Lexical::Token Lexical::Session::token(size_t i) const {
+  const TokenView& tok = tokens_[i];
+  return {type_name(tok), std::string(lexeme(tok)), tok.type};
+}
+
+std::vector<Lexical::Token> Lexical::Session::tokens() const {
+  std::vector<Token> result;
+  result.reserve(tokens_.size());
+  for (size_t i = 0; i < tokens_.size(); ++i) {
+    result.push_back(token(i));
+  }
+  return result;
+}
+
+size_t Lexical::Session::memory_usage() const {
+  return source_.capacity() + tokens_.capacity() * sizeof(TokenView);
+}
+
+std::string Lexical::read_input(const std::string& input) {
   std::ifstream file(input);
   if (file.good()) {
     std::stringstream buffer;
     buffer << file.rdbuf();
-    source = buffer.str();
-  } else {
-    source = input;
+    return buffer.str();
+  }
+  return input;
+}
+
+std::vector<Lexical::Token> Lexical::analyze(const std::string& input) {
+  tokens_ = scan(input).tokens();
+  return tokens_;
+}
+
+Lexical::Session Lexical::scan(const std::string& input) const {
+  Session session;
+  session.source_ = read_input(input);
+  session.types_ = type_names_;
+
+  const std::string& source = session.source_;
+  if (source.size() > UINT32_MAX) {
+    std::cerr << "[Lexical] 输入超过 4GB，无法分析" << std::endl;
+    return session;
   }
 
-  tokens_.clear();
-  std::regex skip_ws(R"([ \t\r]+)");
   size_t pos = 0;
   while (pos < source.length()) {
-    std::smatch match;
-    if (std::regex_search(source.cbegin() + pos, source.cend(), match, skip_ws) && match.position() == 0) {
-      pos += match.length();
+    // 跳过空白（换行作为 NEWLINE 记号保留）
+    char c = source[pos];
+    if (c == ' ' || c == '\t' || c == '\r') {
+      ++pos;
       continue;
     }
 
-    bool matched = false;
-    for (const auto& [type, regex] : regex_rules_) {
-      // std::cout << "type: " << type << std::endl;
-      if (std::regex_search(source.cbegin() + pos, source.cend(), match, regex)) {
-        tokens_.push_back({type, match.str()});
-        pos += match.length();
-        matched = true;
-        break;
-      }
+    size_t length = 0;
+    int rule = engine() == Engine::DFA ? match_dfa(source, pos, length) : match_regex(source, pos, length);
+    if (rule >= 0 && length > MAX_LEXEME_LENGTH) {
+      std::cerr << "[Lexical] 位置 " << pos << " 的词素过长，无法分析" << std::endl;
+      break;
     }
-    if (!matched) {
-      tokens_.push_back({"UNKNOWN", std::string(1, source[pos])});
+    if (rule >= 0) {
+      session.tokens_.push_back({static_cast<uint32_t>(pos), static_cast<uint32_t>(length), rule_types_[rule]});
+      pos += length;
+    } else {
+      session.tokens_.push_back({static_cast<uint32_t>(pos), 1, unknown_type_});
       ++pos;
     }
   }
 
-  return tokens_;
+  session.tokens_.shrink_to_fit();
+  return session;
+}
+
+int Lexical::type_id(const std::string& type) const {
+  for (size_t i = 0; i < type_names_->size(); ++i) {
+    if ((*type_names_)[i] == type) return static_cast<int>(i);
+  }
+  return -1;
+}
+
+std::vector<SymbolId> Lexical::symbol_ids(const SymbolInterner& symbols) const {
+  std::vector<SymbolId> ids;
+  ids.reserve(type_names_->size());
+  for (const auto& type : *type_names_) {
+    ids.push_back(symbols.find(type));
+  }
+  return ids;
+}
+
+int Lexical::match_dfa(const std::string& source, size_t pos, size_t& length) const {
+  const char* begin = source.data() + pos;
+  return dfa_.match(begin, source.data() + source.size(), length);
+}
+
+int Lexical::match_regex(const std::string& source, size_t pos, size_t& length) const {
+  for (size_t i = 0; i < regex_rules_.size(); ++i) {
+    std::smatch match;
+    if (std::regex_search(source.cbegin() + pos, source.cend(), match, regex_rules_[i].second) && match.length() > 0) {
+      length = match.length();
+      return static_cast<int>(i);
+    }
+  }
+  length = 0;
+  return -1;
+}
+
+void Lexical::set_engine(Engine engine) {
+  engine_ = engine;
+}
+
+Lexical::Engine Lexical::engine() const {
+  return engine_ == Engine::DFA && dfa_.ready() ? Engine::DFA : Engine::REGEX;
+}
+
+// C++ 字符串字面量，非 ASCII 和特殊字符用三位八进制转义
+static std::string cpp_literal(const std::string& text) {
+  std::string literal = "\"";
+  for (unsigned char ch : text) {
+    if (ch >= 0x20 && ch < 0x7f && ch != '\\' && ch != '"' && ch != '?') {
+      literal += static_cast<char>(ch);
+    } else {
+      char escaped[5];
+      std::snprintf(escaped, sizeof(escaped), "\\%03o", ch);
+      literal += escaped;
+    }
+  }
+  return literal + "\"";
+}
+
+bool Lexical::to_cpp(const std::string& source, const std::string& header, const std::string& name) const {
+  if (!dfa_.ready()) {
+    std::cerr << "[Lexical] 规则无法编译为 DFA，不能生成词法分析器" << std::endl;
+    return false;
+  }
+
+  std::ofstream hpp(header);
+  std::ofstream cpp(source);
+  if (!hpp || !cpp) {
+    std::cerr << "[Lexical] 无法写入 " << source << " / " << header << std::endl;
+    return false;
+  }
+
+  std::string guard = name;
+  std::transform(guard.begin(), guard.end(), guard.begin(), [](unsigned char c) { return std::toupper(c); });
+  guard += "_GENERATED_HPP";
+  hpp << "// 由 Lexical::to_cpp 生成，请勿手动修改\n"
+      << "#ifndef " << guard << "\n#define " << guard << "\n\n"
+      << "#include \"basic/lexical.hpp\"\n\n"
+      << "namespace generated {\n\n"
+      << "// 类型 id -> 类型字符串（与 Lexical::type_name 相同）\n"
+      << "constexpr size_t " << name << "_type_count = " << type_names_->size() << ";\n"
+      << "extern const char* const " << name << "_types[" << name << "_type_count];\n\n"
+      << "// 从 begin 开始做最长匹配，返回类型 id（-1 表示未匹配），length 为匹配长度\n"
+      << "int " << name << "_match(const char* begin, const char* end, size_t& length);\n\n"
+      << "// 分析源码文本，结果与 Lexical::analyze 相同\n"
+      << "std::vector<Lexical::Token> " << name << "_analyze(const std::string& source);\n\n"
+      << "} // namespace generated\n\n"
+      << "#endif // " << guard << "\n";
+
+  cpp << "// 由 Lexical::to_cpp 生成，请勿手动修改\n"
+      << "#include \"" << std::filesystem::path(header).filename().string() << "\"\n\n"
+      << "namespace generated {\n\n"
+      << "const char* const " << name << "_types[" << name << "_type_count] = {\n";
+  for (const auto& type : *type_names_) {
+    cpp << "  " << cpp_literal(type) << ",\n";
+  }
+  cpp << "};\n\n"
+      << "static bool is_word(unsigned char c) {\n"
+      << "  return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';\n"
+      << "}\n\n";
+  dfa_.to_cpp(cpp, name + "_match", rule_types_);
+  cpp << "\n"
+      << "std::vector<Lexical::Token> " << name << "_analyze(const std::string& source) {\n"
+      << "  std::vector<Lexical::Token> tokens;\n"
+      << "  const char* end = source.data() + source.size();\n"
+      << "  size_t pos = 0;\n"
+      << "  while (pos < source.size()) {\n"
+      << "    // 跳过空白（换行作为 NEWLINE 记号保留）\n"
+      << "    char c = source[pos];\n"
+      << "    if (c == ' ' || c == '\\t' || c == '\\r') {\n"
+      << "      ++pos;\n"
+      << "      continue;\n"
+      << "    }\n"
+      << "    size_t length = 0;\n"
+      << "    int type = " << name << "_match(source.data() + pos, end, length);\n"
+      << "    if (type >= 0) {\n"
+      << "      tokens.push_back({" << name << "_types[type], source.substr(pos, length)});\n"
+      << "      pos += length;\n"
+      << "    } else {\n"
+      << "      tokens.push_back({" << name << "_types[" << unknown_type_ << "], source.substr(pos, 1)});\n"
+      << "      ++pos;\n"
+      << "    }\n"
+      << "  }\n"
+      << "  return tokens;\n"
+      << "}\n\n"
+      << "} // namespace generated\n";
+  return true;
 }
 
 void Lexical::to_txt(const std::string& output_path) const {
@@ -99,6 +260,16 @@ void Lexical::parse_stream(const std::string &file) {
   }
 
   regex_rules_.clear();
+  rule_types_.clear();
+  dfa_ = LexicalDfa();
+  // 新建类型表，已有会话仍持有旧表
+  auto type_names = std::make_shared<std::vector<std::string>>();
+  auto finish_types = [&]() {
+    auto unknown = std::find(type_names->begin(), type_names->end(), "UNKNOWN");
+    unknown_type_ = static_cast<uint32_t>(unknown - type_names->begin());
+    if (unknown == type_names->end()) type_names->push_back("UNKNOWN");
+    type_names_ = type_names;
+  };
   std::vector<std::pair<int, std::vector<std::pair<std::string, std::string>>>> sorted;
 
   for (auto& [priority_str, rules] : j.items()) {
@@ -112,15 +283,34 @@ void Lexical::parse_stream(const std::string &file) {
 
   std::sort(sorted.begin(), sorted.end());
 
+  std::vector<LexicalDfa::Rule> rules;
   for (auto& [_, group] : sorted) {
     for (auto& [type, pattern] : group) {
       try {
         regex_rules_.emplace_back(type, std::regex("^(" + pattern + ")"));
+        rules.emplace_back(type, pattern);
+        auto it = std::find(type_names->begin(), type_names->end(), type);
+        rule_types_.push_back(static_cast<uint32_t>(it - type_names->begin()));
+        if (it == type_names->end()) type_names->push_back(type);
       } catch (const std::regex_error& e) {
         std::cerr << "[Lexical] 错误的正则表达式. type: " << type << ", pattern: " << pattern
                   << std::endl << e.what() << std::endl;
+        finish_types();
         return;
       }
     }
   }
+
+  finish_types();
+  if (type_names_->size() > MAX_TYPE_COUNT) {
+    std::cerr << "[Lexical] 记号类型超过 " << MAX_TYPE_COUNT << " 种" << std::endl;
+    regex_rules_.clear();
+    rule_types_.clear();
+    return;
+  }
+
+  // 所有规则合并成一个 DFA，下标即优先级
+  if (!dfa_.compile(rules)) {
+    std::cerr << "[Lexical] 规则无法编译为 DFA (" << dfa_.error() << "), 改用 std::regex 逐条匹配" << std::endl;
+  }
 }
@@ -2,9 +2,14 @@
 #define LEXICAL_HPP
 
 #include <string>
+#include <string_view>
 #include <vector>
+#include <memory>
+#include <cstdint>
 #include <regex>
 #include <ostream>
+#include "lexical_dfa.hpp"
+#include "symbol_interner.hpp"
 
 const std::string LEXICAL_NORMAL = "input/lexical/lexical_normal.json";
 const std::string LEXICAL_EXTEND = "input/lexical/lexical_extend.json";
@@ -12,15 +17,64 @@ const std::string LEXICAL_EXTEND = "input/lexical/lexical_extend.json";
 // 词法分析类：封装从 JSON 配置加载规则、分析输入、输出结果
 class Lexical {
 public:
+  // 匹配引擎：合并后的 DFA（默认），或逐条尝试 std::regex（用于对照和 DFA 不支持的规则）
+  enum class Engine { DFA, REGEX };
+
+  // 记号不是由词法分析产生时的类型 id
+  static constexpr uint32_t NO_TYPE = UINT32_MAX;
+
   // 词法记号结构体，类型使用字符串
   struct Token {
     std::string type;     // 类型字符串，如 "ID", "NUM", "IF"
     std::string lexeme;   // 匹配到的原始文本
+    uint32_t type_id = NO_TYPE; // 类型 id，见 Lexical::type_name()
 
     // 支持输出 (type, lexeme)
     friend std::ostream& operator<<(std::ostream& os, const Token& tok);
   };
 
+  // 零拷贝记号：词素是会话源码缓冲区中的 [offset, offset + length)，类型为整数 id
+  // 每个记号 8 字节，词素长度不超过 MAX_LEXEME_LENGTH，类型数不超过 MAX_TYPE_COUNT
+  struct TokenView {
+    uint32_t offset;      // 词素在源码中的起始位置
+    uint32_t length : 24; // 词素长度
+    uint32_t type : 8;    // 类型 id，见 Lexical::type_name()
+  };
+  static constexpr size_t MAX_LEXEME_LENGTH = (1u << 24) - 1;
+  static constexpr size_t MAX_TYPE_COUNT = 1u << 8;
+
+  // 词法分析会话：持有源码缓冲区和 TokenView 序列，词素不再逐个分配
+  class Session {
+  public:
+    size_t size() const { return tokens_.size(); }
+    bool empty() const { return tokens_.empty(); }
+    const TokenView& operator[](size_t i) const { return tokens_[i]; }
+    std::vector<TokenView>::const_iterator begin() const { return tokens_.begin(); }
+    std::vector<TokenView>::const_iterator end() const { return tokens_.end(); }
+
+    // 源码缓冲区
+    const std::string& source() const { return source_; }
+
+    // 记号的词素，指向 source() 内部
+    std::string_view lexeme(const TokenView& tok) const { return {source_.data() + tok.offset, tok.length}; }
+
+    // 记号的类型字符串
+    const std::string& type_name(const TokenView& tok) const { return (*types_)[tok.type]; }
+
+    // 转换为旧的 Token 接口
+    Token token(size_t i) const;
+    std::vector<Token> tokens() const;
+
+    // 会话占用的字节数（源码 + 记号数组）
+    size_t memory_usage() const;
+
+  private:
+    friend class Lexical;
+    std::string source_;
+    std::vector<TokenView> tokens_;
+    std::shared_ptr<const std::vector<std::string>> types_;  // 类型 id -> 类型字符串
+  };
+
   // 构造函数：从 JSON 文件加载正则规则
   explicit Lexical(const std::string& content);
 
@@ -31,13 +85,50 @@ public:
   // 输入可以是源码字符串或文件路径，自动判断
   std::vector<Token> analyze(const std::string& input);
 
+  // 零拷贝分析：输入可以是源码字符串或文件路径，自动判断
+  Session scan(const std::string& input) const;
+
+  // 类型 id 与类型字符串互转，未知类型返回 -1
+  int type_id(const std::string& type) const;
+  const std::string& type_name(uint32_t id) const { return (*type_names_)[id]; }
+  size_t type_count() const { return type_names_->size(); }
+
+  // 类型 id -> 文法符号 id 的映射（不是文法符号的类型为 NO_SYMBOL）
+  std::vector<SymbolId> symbol_ids(const SymbolInterner& symbols) const;
+
   // 输出所有 Token 到文件（NEWLINE 输出为换行符）
   void to_txt(const std::string& output_path) const;
 
+  // 生成专用词法分析器（re2c 风格，不依赖正则引擎，也不在启动时解析规则）：
+  // header 声明、source 定义 generated 命名空间中的
+  //   name_types[]（类型 id -> 类型字符串）、name_match()（最长匹配，返回类型 id）、
+  //   name_analyze()（对源码文本分析，记号与 analyze() 相同）
+  // 规则无法编译为 DFA 时返回 false
+  bool to_cpp(const std::string& source, const std::string& header, const std::string& name) const;
+
+  // 选择匹配引擎，规则无法编译为 DFA 时总是使用 std::regex
+  void set_engine(Engine engine);
+
+  // 当前实际使用的匹配引擎
+  Engine engine() const;
+
 private:
   std::vector<Token> tokens_;                                    // 词法分析结果
   std::vector<std::pair<std::string, std::regex>> regex_rules_;  // (type, regex)
+  std::vector<uint32_t> rule_types_;                             // 规则下标 -> 类型 id
+  std::shared_ptr<std::vector<std::string>> type_names_ =
+      std::make_shared<std::vector<std::string>>(1, "UNKNOWN");   // 类型 id -> 类型字符串，会话共享
+  uint32_t unknown_type_ = 0;                                    // UNKNOWN 的类型 id
+  LexicalDfa dfa_;                                               // 所有规则合并成的 DFA
+  Engine engine_ = Engine::DFA;                                  // 选择的匹配引擎
   void parse_stream(const std::string& file);
+
+  // 读取输入：文件存在则读文件，否则当作源码
+  static std::string read_input(const std::string& input);
+
+  // 用 DFA / std::regex 匹配 source[pos..]，返回规则下标（-1 为未匹配）
+  int match_dfa(const std::string& source, size_t pos, size_t& length) const;
+  int match_regex(const std::string& source, size_t pos, size_t& length) const;
 };
 
 #endif // LEXICAL_HPP
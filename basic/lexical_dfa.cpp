@@ -0,0 +1,652 @@
+#include "lexical_dfa.hpp"
+#include <bitset>
+#include <map>
+#include <algorithm>
+#include <stdexcept>
+#include <cctype>
+
+namespace {
+
+using ByteSet = std::bitset<256>;
+
+// 正则语法树结点
+struct Node {
+  enum Kind { EMPTY, BYTES, CAT, ALT, STAR, PLUS, OPT, BOUNDARY } kind = EMPTY;
+  ByteSet bytes;          // BYTES 结点可接受的字节
+  std::vector<Node> kids; // 子结点
+};
+
+// 不支持的语法
+struct Unsupported : std::runtime_error {
+  using std::runtime_error::runtime_error;
+};
+
+// 解析 ECMAScript 正则的一个子集（按字节处理，UTF-8 字符即若干个字节）
+class RegexParser {
+public:
+  explicit RegexParser(const std::string& pattern) : p_(pattern) {}
+
+  Node parse() {
+    Node node = parse_alt();
+    if (pos_ != p_.size()) throw Unsupported("多余的 ')'");
+    return node;
+  }
+
+private:
+  const std::string& p_;
+  size_t pos_ = 0;
+
+  bool more() const { return pos_ < p_.size(); }
+  unsigned char peek() const { return static_cast<unsigned char>(p_[pos_]); }
+
+  static ByteSet range(int lo, int hi) {
+    ByteSet set;
+    for (int c = lo; c <= hi; ++c) set.set(c);
+    return set;
+  }
+
+  static ByteSet digit_set() { return range('0', '9'); }
+
+  static ByteSet word_set() {
+    ByteSet set = range('0', '9') | range('a', 'z') | range('A', 'Z');
+    set.set('_');
+    return set;
+  }
+
+  static ByteSet space_set() {
+    ByteSet set;
+    for (char c : std::string(" \t\n\v\f\r")) set.set(static_cast<unsigned char>(c));
+    return set;
+  }
+
+  static Node bytes(const ByteSet& set) {
+    Node node;
+    node.kind = Node::BYTES;
+    node.bytes = set;
+    return node;
+  }
+
+  Node parse_alt() {
+    std::vector<Node> branches;
+    branches.push_back(parse_seq());
+    while (more() && peek() == '|') {
+      ++pos_;
+      branches.push_back(parse_seq());
+    }
+    if (branches.size() == 1) return std::move(branches[0]);
+    Node node;
+    node.kind = Node::ALT;
+    node.kids = std::move(branches);
+    return node;
+  }
+
+  Node parse_seq() {
+    Node node;
+    node.kind = Node::CAT;
+    while (more() && peek() != '|' && peek() != ')') {
+      node.kids.push_back(parse_repeat());
+    }
+    if (node.kids.empty()) return Node{};
+    if (node.kids.size() == 1) return std::move(node.kids[0]);
+    return node;
+  }
+
+  Node parse_repeat() {
+    Node atom = parse_atom();
+    while (more()) {
+      unsigned char c = peek();
+      size_t min_count = 0, max_count = 0;
+      bool bounded = true;
+      if (c == '*') {
+        ++pos_;
+        atom = wrap(Node::STAR, std::move(atom));
+      } else if (c == '+') {
+        ++pos_;
+        atom = wrap(Node::PLUS, std::move(atom));
+      } else if (c == '?') {
+        ++pos_;
+        atom = wrap(Node::OPT, std::move(atom));
+      } else if (c == '{' && parse_braces(min_count, max_count, bounded)) {
+        atom = expand(atom, min_count, max_count, bounded);
+      } else {
+        break;
+      }
+      // 非贪婪量词在最长匹配语义下没有对应物
+      if (more() && peek() == '?') throw Unsupported("非贪婪量词");
+    }
+    return atom;
+  }
+
+  static Node wrap(Node::Kind kind, Node kid) {
+    if (kid.kind == Node::BOUNDARY) throw Unsupported("对 \\b 使用量词");
+    Node node;
+    node.kind = kind;
+    node.kids.push_back(std::move(kid));
+    return node;
+  }
+
+  // 解析 {n} {n,} {n,m}，不是合法量词时按普通字符 '{' 处理
+  bool parse_braces(size_t& min_count, size_t& max_count, bool& bounded) {
+    size_t i = pos_ + 1;
+    auto read_number = [&](size_t& out) {
+      size_t start = i;
+      out = 0;
+      while (i < p_.size() && std::isdigit(static_cast<unsigned char>(p_[i]))) {
+        out = out * 10 + (p_[i] - '0');
+        ++i;
+      }
+      return i > start;
+    };
+    if (!read_number(min_count)) return false;
+    max_count = min_count;
+    bounded = true;
+    if (i < p_.size() && p_[i] == ',') {
+      ++i;
+      if (!read_number(max_count)) bounded = false;
+    }
+    if (i >= p_.size() || p_[i] != '}') return false;
+    if (bounded && max_count < min_count) throw Unsupported("量词范围错误");
+    pos_ = i + 1;
+    return true;
+  }
+
+  static Node expand(const Node& atom, size_t min_count, size_t max_count, bool bounded) {
+    if (atom.kind == Node::BOUNDARY) throw Unsupported("对 \\b 使用量词");
+    Node node;
+    node.kind = Node::CAT;
+    for (size_t i = 0; i < min_count; ++i) node.kids.push_back(atom);
+    if (!bounded) {
+      node.kids.push_back(wrap(Node::STAR, atom));
+    } else {
+      for (size_t i = min_count; i < max_count; ++i) node.kids.push_back(wrap(Node::OPT, atom));
+    }
+    if (node.kids.empty()) return Node{};
+    return node;
+  }
+
+  Node parse_atom() {
+    unsigned char c = peek();
+    ++pos_;
+    switch (c) {
+      case '(': {
+        if (pos_ + 1 < p_.size() && p_[pos_] == '?') {
+          if (p_[pos_ + 1] != ':') throw Unsupported("断言分组");
+          pos_ += 2;
+        }
+        Node node = parse_alt();
+        if (!more() || peek() != ')') throw Unsupported("缺少 ')'");
+        ++pos_;
+        return node;
+      }
+      case '[':
+        return bytes(parse_class());
+      case '.': {
+        ByteSet set;
+        set.set();
+        set.reset('\n');
+        set.reset('\r');
+        return bytes(set);
+      }
+      case '^':
+      case '$':
+        throw Unsupported("锚点");
+      case '*':
+      case '+':
+      case '?':
+        throw Unsupported("量词前没有内容");
+      case '\\':
+        return parse_escape(false);
+      default: {
+        ByteSet set;
+        set.set(c);
+        return bytes(set);
+      }
+    }
+  }
+
+  // 解析 '\' 之后的内容；in_class 表示在 [] 内部
+  Node parse_escape(bool in_class) {
+    if (!more()) throw Unsupported("结尾的 '\\'");
+    unsigned char c = peek();
+    ++pos_;
+    ByteSet set;
+    switch (c) {
+      case 'd': return bytes(digit_set());
+      case 'D': return bytes(~digit_set());
+      case 'w': return bytes(word_set());
+      case 'W': return bytes(~word_set());
+      case 's': return bytes(space_set());
+      case 'S': return bytes(~space_set());
+      case 'n': set.set('\n'); return bytes(set);
+      case 'r': set.set('\r'); return bytes(set);
+      case 't': set.set('\t'); return bytes(set);
+      case 'f': set.set('\f'); return bytes(set);
+      case 'v': set.set('\v'); return bytes(set);
+      case '0': set.set(0); return bytes(set);
+      case 'b':
+        if (in_class) {
+          set.set('\b');
+          return bytes(set);
+        } else {
+          Node node;
+          node.kind = Node::BOUNDARY;
+          return node;
+        }
+      case 'x': {
+        if (pos_ + 2 > p_.size()) throw Unsupported("\\x 转义不完整");
+        int value = std::stoi(p_.substr(pos_, 2), nullptr, 16);
+        pos_ += 2;
+        set.set(value);
+        return bytes(set);
+      }
+      case 'B':
+      case 'c':
+      case 'u':
+      case 'k':
+        throw Unsupported(std::string("转义 \\") + static_cast<char>(c));
+      default:
+        if (c >= '1' && c <= '9') throw Unsupported("反向引用");
+        // 其余都是原样转义，例如 \+ \( 以及 UTF-8 字符的首字节
+        set.set(c);
+        return bytes(set);
+    }
+  }
+
+  ByteSet parse_class() {
+    ByteSet set;
+    bool negate = false;
+    if (more() && peek() == '^') {
+      negate = true;
+      ++pos_;
+    }
+    while (more() && peek() != ']') {
+      ByteSet lo = class_atom();
+      // 区间 a-z
+      if (pos_ + 1 < p_.size() && p_[pos_] == '-' && p_[pos_ + 1] != ']' && lo.count() == 1) {
+        ++pos_;
+        ByteSet hi = class_atom();
+        if (hi.count() != 1) throw Unsupported("字符类区间端点不是单个字符");
+        int from = first_of(lo), to = first_of(hi);
+        if (from > to) throw Unsupported("字符类区间颠倒");
+        for (int ch = from; ch <= to; ++ch) set.set(ch);
+      } else {
+        set |= lo;
+      }
+    }
+    if (!more()) throw Unsupported("缺少 ']'");
+    ++pos_;
+    return negate ? ~set : set;
+  }
+
+  ByteSet class_atom() {
+    unsigned char c = peek();
+    ++pos_;
+    if (c == '\\') return parse_escape(true).bytes;
+    ByteSet set;
+    set.set(c);
+    return set;
+  }
+
+  static int first_of(const ByteSet& set) {
+    for (int c = 0; c < 256; ++c) {
+      if (set.test(c)) return c;
+    }
+    return -1;
+  }
+};
+
+// Thompson NFA
+struct Nfa {
+  struct State {
+    std::vector<int> eps; // ε 边
+    ByteSet bytes;        // 字节边
+    int next = -1;        // 字节边目标
+    int accept = -1;      // 接受的规则下标
+  };
+  std::vector<State> states;
+
+  int add() {
+    states.emplace_back();
+    return static_cast<int>(states.size()) - 1;
+  }
+
+  // 返回 (start, end)
+  std::pair<int, int> build(const Node& node) {
+    switch (node.kind) {
+      case Node::EMPTY: {
+        int s = add();
+        return {s, s};
+      }
+      case Node::BYTES: {
+        int s = add(), e = add();
+        states[s].bytes = node.bytes;
+        states[s].next = e;
+        return {s, e};
+      }
+      case Node::CAT: {
+        auto [start, end] = build(node.kids[0]);
+        for (size_t i = 1; i < node.kids.size(); ++i) {
+          auto [s, e] = build(node.kids[i]);
+          states[end].eps.push_back(s);
+          end = e;
+        }
+        return {start, end};
+      }
+      case Node::ALT: {
+        int s = add(), e = add();
+        for (const auto& kid : node.kids) {
+          auto [ks, ke] = build(kid);
+          states[s].eps.push_back(ks);
+          states[ke].eps.push_back(e);
+        }
+        return {s, e};
+      }
+      case Node::STAR:
+      case Node::OPT:
+      case Node::PLUS: {
+        int s = add(), e = add();
+        auto [ks, ke] = build(node.kids[0]);
+        states[s].eps.push_back(ks);
+        states[ke].eps.push_back(e);
+        if (node.kind != Node::PLUS) states[s].eps.push_back(e);
+        if (node.kind != Node::OPT) states[ke].eps.push_back(ks);
+        return {s, e};
+      }
+      case Node::BOUNDARY:
+        break;
+    }
+    throw Unsupported("位置不支持的 \\b");
+  }
+
+  // 求 ε 闭包，结果升序
+  std::vector<int> closure(std::vector<int> set) const {
+    std::vector<char> seen(states.size(), 0);
+    std::vector<int> stack = set;
+    for (int s : set) seen[s] = 1;
+    while (!stack.empty()) {
+      int s = stack.back();
+      stack.pop_back();
+      for (int t : states[s].eps) {
+        if (!seen[t]) {
+          seen[t] = 1;
+          set.push_back(t);
+          stack.push_back(t);
+        }
+      }
+    }
+    std::sort(set.begin(), set.end());
+    return set;
+  }
+};
+
+} // namespace
+
+bool LexicalDfa::is_word(unsigned char c) {
+  return (c < 0x80 && std::isalnum(c)) || c == '_';
+}
+
+bool LexicalDfa::compile(const std::vector<Rule>& rules) {
+  byte_class_.clear();
+  next_.clear();
+  accept_offset_.clear();
+  accept_rules_.clear();
+  boundary_before_.assign(rules.size(), 0);
+  boundary_after_.assign(rules.size(), 0);
+  classes_ = 0;
+  start_ = -1;
+  error_.clear();
+
+  // 1. 解析每条规则并构造 NFA，首尾的 \b 单独记录
+  Nfa nfa;
+  int nfa_start = nfa.add();
+  std::vector<ByteSet> edge_sets;
+  try {
+    for (size_t r = 0; r < rules.size(); ++r) {
+      Node node = RegexParser(rules[r].second).parse();
+      if (node.kind == Node::CAT) {
+        if (node.kids.front().kind == Node::BOUNDARY) {
+          boundary_before_[r] = 1;
+          node.kids.erase(node.kids.begin());
+        }
+        if (!node.kids.empty() && node.kids.back().kind == Node::BOUNDARY) {
+          boundary_after_[r] = 1;
+          node.kids.pop_back();
+        }
+        if (node.kids.empty()) node = Node{};
+      }
+      auto [s, e] = nfa.build(node);
+      nfa.states[nfa_start].eps.push_back(s);
+      nfa.states[e].accept = static_cast<int>(r);
+    }
+  } catch (const std::exception& e) {
+    error_ = e.what();
+    return false;
+  }
+
+  // 2. 按所有字节边划分字节等价类
+  for (const auto& state : nfa.states) {
+    if (state.next >= 0) edge_sets.push_back(state.bytes);
+  }
+  byte_class_.assign(256, 0);
+  {
+    std::map<std::vector<bool>, int> signature_to_class;
+    for (int c = 0; c < 256; ++c) {
+      std::vector<bool> signature;
+      signature.reserve(edge_sets.size());
+      for (const auto& set : edge_sets) signature.push_back(set.test(c));
+      auto [it, inserted] = signature_to_class.emplace(signature, static_cast<int>(signature_to_class.size()));
+      byte_class_[c] = static_cast<unsigned char>(it->second);
+    }
+    classes_ = signature_to_class.size();
+  }
+  std::vector<int> representative(classes_, -1);
+  for (int c = 0; c < 256; ++c) {
+    if (representative[byte_class_[c]] < 0) representative[byte_class_[c]] = c;
+  }
+
+  // 3. 子集构造
+  std::map<std::vector<int>, int> subset_to_state;
+  std::vector<std::vector<int>> subsets;
+  std::vector<int> table;
+  subsets.push_back(nfa.closure({nfa_start}));
+  subset_to_state.emplace(subsets[0], 0);
+  for (size_t i = 0; i < subsets.size(); ++i) {
+    table.resize((i + 1) * classes_, -1);
+    for (size_t cls = 0; cls < classes_; ++cls) {
+      std::vector<int> moved;
+      for (int s : subsets[i]) {
+        const auto& state = nfa.states[s];
+        if (state.next >= 0 && state.bytes.test(representative[cls])) moved.push_back(state.next);
+      }
+      if (moved.empty()) continue;
+      std::vector<int> target = nfa.closure(moved);
+      auto [it, inserted] = subset_to_state.emplace(target, static_cast<int>(subsets.size()));
+      if (inserted) subsets.push_back(target);
+      table[i * classes_ + cls] = it->second;
+    }
+  }
+  const size_t dfa_states = subsets.size();
+  std::vector<std::vector<int>> accepts(dfa_states);
+  for (size_t i = 0; i < dfa_states; ++i) {
+    for (int s : subsets[i]) {
+      if (nfa.states[s].accept >= 0) accepts[i].push_back(nfa.states[s].accept);
+    }
+    std::sort(accepts[i].begin(), accepts[i].end());
+  }
+
+  // 4. 到达不了接受状态的状态视为死状态，扫描时可以尽早停下
+  std::vector<char> alive(dfa_states, 0);
+  for (bool changed = true; changed;) {
+    changed = false;
+    for (size_t i = 0; i < dfa_states; ++i) {
+      if (alive[i]) continue;
+      bool ok = !accepts[i].empty();
+      for (size_t cls = 0; cls < classes_ && !ok; ++cls) {
+        int t = table[i * classes_ + cls];
+        ok = t >= 0 && alive[t];
+      }
+      if (ok) {
+        alive[i] = 1;
+        changed = true;
+      }
+    }
+  }
+  for (int& t : table) {
+    if (t >= 0 && !alive[t]) t = -1;
+  }
+
+  // 5. Moore 算法最小化：按接受规则集合初始划分，反复细分直到稳定
+  std::vector<int> block(dfa_states, 0);
+  {
+    std::map<std::vector<int>, int> initial;
+    for (size_t i = 0; i < dfa_states; ++i) {
+      block[i] = initial.emplace(accepts[i], static_cast<int>(initial.size())).first->second;
+    }
+  }
+  for (size_t block_count = 0;;) {
+    std::map<std::vector<int>, int> refined;
+    std::vector<int> next_block(dfa_states);
+    for (size_t i = 0; i < dfa_states; ++i) {
+      std::vector<int> signature;
+      signature.reserve(classes_ + 1);
+      signature.push_back(block[i]);
+      for (size_t cls = 0; cls < classes_; ++cls) {
+        int t = table[i * classes_ + cls];
+        signature.push_back(t < 0 ? -1 : block[t]);
+      }
+      next_block[i] = refined.emplace(signature, static_cast<int>(refined.size())).first->second;
+    }
+    block.swap(next_block);
+    if (refined.size() == block_count) break;
+    block_count = refined.size();
+  }
+
+  // 6. 生成最小化后的转移表，起始状态重新编号为 0
+  const int start_block = block[0];
+  auto renumber = [&](int b) { return b == start_block ? 0 : (b == 0 ? start_block : b); };
+  size_t min_states = 0;
+  for (int b : block) min_states = std::max(min_states, static_cast<size_t>(b) + 1);
+  next_.assign(min_states * classes_, -1);
+  std::vector<std::vector<int>> min_accepts(min_states);
+  for (size_t i = 0; i < dfa_states; ++i) {
+    int b = renumber(block[i]);
+    min_accepts[b] = accepts[i];
+    for (size_t cls = 0; cls < classes_; ++cls) {
+      int t = table[i * classes_ + cls];
+      next_[b * classes_ + cls] = t < 0 ? -1 : renumber(block[t]);
+    }
+  }
+  accept_offset_.push_back(0);
+  for (const auto& list : min_accepts) {
+    accept_rules_.insert(accept_rules_.end(), list.begin(), list.end());
+    accept_offset_.push_back(static_cast<int>(accept_rules_.size()));
+  }
+  start_ = 0;
+  return true;
+}
+
+bool LexicalDfa::boundary_ok(int rule, const char* begin, const char* end, size_t length) const {
+  // 与 std::regex 在子串上搜索时一致：子串开头视为输入开头
+  if (boundary_before_[rule] && !is_word(static_cast<unsigned char>(begin[0]))) {
+    return false;
+  }
+  if (boundary_after_[rule]) {
+    bool left = is_word(static_cast<unsigned char>(begin[length - 1]));
+    bool right = begin + length < end && is_word(static_cast<unsigned char>(begin[length]));
+    if (left == right) return false;
+  }
+  return true;
+}
+
+int LexicalDfa::match(const char* begin, const char* end, size_t& length) const {
+  length = 0;
+  if (!ready()) return -1;
+
+  int best_rule = -1;
+  int state = start_;
+  for (size_t i = 0; begin + i < end;) {
+    state = next_[state * classes_ + byte_class_[static_cast<unsigned char>(begin[i])]];
+    if (state < 0) break;
+    ++i;
+    // 更长的匹配总是覆盖之前的结果；同一长度取优先级最高且满足 \b 约束的规则
+    for (int k = accept_offset_[state]; k < accept_offset_[state + 1]; ++k) {
+      int rule = accept_rules_[k];
+      if (boundary_ok(rule, begin, end, i)) {
+        best_rule = rule;
+        length = i;
+        break;
+      }
+    }
+  }
+  return best_rule;
+}
+
+// case 标签：可打印的 ASCII 写成字符字面量，其余写成十六进制
+static std::string byte_literal(int c) {
+  if (c >= 0x20 && c < 0x7f && c != '\'' && c != '\\') {
+    return std::string("'") + static_cast<char>(c) + "'";
+  }
+  static const char digits[] = "0123456789abcdef";
+  return std::string("0x") + digits[c >> 4] + digits[c & 15];
+}
+
+bool LexicalDfa::to_cpp(std::ostream& out, const std::string& function, const std::vector<uint32_t>& results) const {
+  if (!ready() || results.size() < boundary_before_.size()) return false;
+  const int states = static_cast<int>(state_count());
+
+  out << "int " << function << "(const char* begin, const char* end, size_t& length) {\n"
+      << "  const char* p = begin;\n"
+      << "  int best = -1;\n"
+      << "  length = 0;\n"
+      << "  goto next_" << start_ << ";\n";
+
+  // 只输出有 goto 跳到的标号：state_N 是转移的目标，next_N 只有起始状态用到
+  std::vector<bool> entered(states, false);
+  for (int target : next_) {
+    if (target >= 0) entered[target] = true;
+  }
+
+  for (int state = 0; state < states; ++state) {
+    out << "\n";
+    if (entered[state]) out << "state_" << state << ":\n";
+    // 接受：同一长度取优先级最高且满足 \b 约束的规则
+    for (int k = accept_offset_[state]; k < accept_offset_[state + 1]; ++k) {
+      const int rule = accept_rules_[k];
+      std::string condition;
+      if (boundary_before_[rule]) {
+        condition += "is_word(begin[0])";
+      }
+      if (boundary_after_[rule]) {
+        if (!condition.empty()) condition += " && ";
+        condition += "is_word(p[-1]) != (p < end && is_word(*p))";
+      }
+      const std::string action = "best = " + std::to_string(results[rule]) + "; length = p - begin;";
+      if (condition.empty()) {
+        out << "  " << (k == accept_offset_[state] ? "" : "else ") << "{ " << action << " }\n";
+        break;
+      }
+      out << "  " << (k == accept_offset_[state] ? "if" : "else if") << " (" << condition << ") { " << action << " }\n";
+    }
+
+    // 转移：目标相同的字节合并成一组 case
+    if (state == start_) out << "next_" << state << ":\n";
+    out << "  if (p == end) return best;\n"
+        << "  switch (static_cast<unsigned char>(*p++)) {\n";
+    std::map<int, std::vector<int>> targets;
+    for (int c = 0; c < 256; ++c) {
+      const int target = next_[state * classes_ + byte_class_[c]];
+      if (target >= 0) targets[target].push_back(c);
+    }
+    for (const auto& [target, bytes] : targets) {
+      for (size_t i = 0; i < bytes.size(); ++i) {
+        out << (i % 8 == 0 ? "    " : " ") << "case " << byte_literal(bytes[i]) << ":"
+            << (i % 8 == 7 || i + 1 == bytes.size() ? "\n" : "");
+      }
+      out << "      goto state_" << target << ";\n";
+    }
+    out << "    default: return best;\n"
+        << "  }\n";
+  }
+  out << "}\n";
+  return true;
+}
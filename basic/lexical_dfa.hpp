@@ -0,0 +1,63 @@
+#ifndef LEXICAL_DFA_HPP
+#define LEXICAL_DFA_HPP
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+// 词法 DFA：把按优先级排好的所有正则规则合并成一个最小化 DFA，
+// 扫描时一次走表完成最长匹配，长度相同时取优先级高（下标小）的规则
+class LexicalDfa {
+public:
+  // 规则：(类型, 正则)
+  using Rule = std::pair<std::string, std::string>;
+
+  // 默认构造函数
+  LexicalDfa() = default;
+
+  // 编译规则，规则下标即优先级（越小越优先）
+  // 遇到 DFA 无法表达的语法（^ $ 反向引用、非首尾的 \b 等）返回 false
+  bool compile(const std::vector<Rule>& rules);
+
+  // 是否已成功编译
+  bool ready() const { return start_ >= 0; }
+
+  // 从 begin 开始做最长匹配，返回命中的规则下标（-1 表示未匹配），length 为匹配长度
+  int match(const char* begin, const char* end, size_t& length) const;
+
+  // 状态数（最小化之后）
+  size_t state_count() const { return accept_offset_.empty() ? 0 : accept_offset_.size() - 1; }
+
+  // 字节等价类数
+  size_t class_count() const { return classes_; }
+
+  // 编译失败时的原因
+  const std::string& error() const { return error_; }
+
+  // 输出为 C++ 函数 int function(const char* begin, const char* end, size_t& length)：
+  // 每个状态一个标签，转移为按字节的 switch + goto，语义同 match()，命中时返回 results[规则下标]
+  // 生成的代码依赖 is_word 函数（由调用方一并输出），未编译时返回 false
+  bool to_cpp(std::ostream& out, const std::string& function, const std::vector<uint32_t>& results) const;
+
+  // 是否是 \b 意义下的单词字符
+  static bool is_word(unsigned char c);
+
+private:
+  std::vector<unsigned char> byte_class_;  // 字节 -> 等价类
+  size_t classes_ = 0;                     // 等价类数
+  std::vector<int> next_;                  // 转移表：state * classes_ + class -> state，-1 为死状态
+  std::vector<int> accept_offset_;         // 每个状态接受规则在 accept_rules_ 中的起始位置（多一个哨兵）
+  std::vector<int> accept_rules_;          // 接受规则，按优先级升序
+  std::vector<unsigned char> boundary_before_; // 规则是否以 \b 开头
+  std::vector<unsigned char> boundary_after_;  // 规则是否以 \b 结尾
+  int start_ = -1;                         // 起始状态
+  std::string error_;                      // 编译失败原因
+
+  // 检查规则 rule 在长度 length 处是否满足首尾的 \b 约束
+  bool boundary_ok(int rule, const char* begin, const char* end, size_t length) const;
+};
+
+#endif // LEXICAL_DFA_HPP
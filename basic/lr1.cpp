@@ -0,0 +1,200 @@
+#include "lr1.hpp"
+#include <algorithm>
+
+LR1Automaton::LR1Automaton(const GrammarSet& grammar_set, bool merge)
+  : grammar_set_(grammar_set), merge_(merge) {
+  grammar_set_.compute_bits();
+  SymbolInterner& symbols = grammar_set_.symbols();
+  ProductionTable& table = grammar_set_.productions();
+
+  // 增广文法 S' -> S
+  const std::string& start_symbol = grammar_set_.start_symbol();
+  Grammar start_grammar(start_symbol + "'", {start_symbol});
+  start_grammar.bind(symbols);
+  int start_production = table.intern(start_grammar);
+
+  terminal_count_ = grammar_set_.terminal_ids().size();
+
+  // 起始状态 [S' -> • S, #]
+  State start;
+  start.kernel = ItemSet(Item(table, start_production, 0));
+  start.core = start.kernel.canonical_key();
+  start.lookaheads.assign(1, bittool::make(terminal_count_));
+  bittool::set(start.lookaheads[0], grammar_set_.terminal_index(SymbolInterner::END));
+  core_index_[start.core].push_back(0);
+  states_.push_back(std::move(start));
+
+  // 按先进先出处理；合并后向前看符号变多的状态重新入队
+  std::vector<int> worklist = {0};
+  for (size_t head = 0; head < worklist.size(); ++head) {
+    expand(worklist[head], worklist);
+  }
+
+  finish();
+}
+
+const std::vector<SymbolId>& LR1Automaton::lookahead(const std::string& state, int production) const {
+  static const std::vector<SymbolId> empty;
+  auto state_it = lookahead_.find(state);
+  if (state_it == lookahead_.end()) return empty;
+  auto it = state_it->second.find(production);
+  return it == state_it->second.end() ? empty : it->second;
+}
+
+std::unordered_map<uint64_t, LR1Automaton::Bits> LR1Automaton::closure(const State& state) const {
+  const ProductionTable& table = grammar_set_.productions();
+  std::unordered_map<uint64_t, Bits> result;
+  std::vector<uint64_t> stk;
+
+  for (size_t i = 0; i < state.core.size(); ++i) {
+    result[state.core[i]] = state.lookaheads[i];
+    stk.push_back(state.core[i]);
+  }
+
+  while (!stk.empty()) {
+    const uint64_t key = stk.back();
+    stk.pop_back();
+    const int prod = static_cast<int>(key >> 32);
+    const size_t dot = static_cast<uint32_t>(key);
+    const size_t length = table.length(prod);
+    if (dot >= length) continue;
+
+    const std::vector<SymbolId>& rhs = table[prod].rhs_ids();
+    const std::vector<int>& expansions = grammar_set_.productions_of(rhs[dot]);
+    if (expansions.empty()) continue;
+
+    // [A -> α • B β, L] 加入 [B -> • γ, FIRST(β L)]
+    Bits lookahead = bittool::make(terminal_count_);
+    bool rest_nullable = true;
+    for (size_t i = dot + 1; i < length; ++i) {
+      bittool::merge(lookahead, grammar_set_.first_bits(rhs[i]));
+      if (!grammar_set_.nullable(rhs[i])) {
+        rest_nullable = false;
+        break;
+      }
+    }
+    if (rest_nullable) {
+      bittool::merge(lookahead, result.at(key));
+    }
+
+    for (int expansion : expansions) {
+      const uint64_t child = static_cast<uint64_t>(expansion) << 32;
+      auto [it, inserted] = result.try_emplace(child, bittool::make(terminal_count_));
+      bool grew = bittool::merge(it->second, lookahead) || inserted;
+      if (grew) stk.push_back(child);
+    }
+  }
+  return result;
+}
+
+void LR1Automaton::expand(int index, std::vector<int>& worklist) {
+  const std::unordered_map<uint64_t, Bits> lookahead = closure(states_[index]);
+  const ItemSet closure_set = states_[index].kernel.closure(grammar_set_);
+
+  for (SymbolId symbol : closure_set.next_symbol_ids()) {
+    ItemSet kernel = closure_set.move(symbol);
+    std::vector<uint64_t> core = kernel.canonical_key();
+
+    // 核项目 (p, dot) 的向前看符号来自闭包中的 (p, dot - 1)
+    std::vector<Bits> lookaheads;
+    lookaheads.reserve(core.size());
+    for (uint64_t key : core) {
+      lookaheads.push_back(lookahead.at(key - 1));
+    }
+
+    int target = find(core, lookaheads);
+    if (target < 0) {
+      target = static_cast<int>(states_.size());
+      core_index_[core].push_back(target);
+      states_.push_back(State{std::move(kernel), std::move(core), std::move(lookaheads), {}});
+      worklist.push_back(target);
+    } else {
+      // 合并向前看符号，变多时目标状态需要重新传播
+      bool grew = false;
+      auto& existing = states_[target].lookaheads;
+      for (size_t i = 0; i < existing.size(); ++i) {
+        grew = bittool::merge(existing[i], lookaheads[i]) || grew;
+      }
+      if (grew) worklist.push_back(target);
+    }
+
+    states_[index].transitions[symbol] = target;
+  }
+}
+
+int LR1Automaton::find(const std::vector<uint64_t>& core, const std::vector<Bits>& lookaheads) const {
+  auto it = core_index_.find(core);
+  if (it == core_index_.end()) return -1;
+
+  for (int index : it->second) {
+    if (states_[index].lookaheads == lookaheads) return index;
+  }
+  if (merge_) {
+    for (int index : it->second) {
+      if (compatible(states_[index].lookaheads, lookaheads)) return index;
+    }
+  }
+  return -1;
+}
+
+bool LR1Automaton::compatible(const std::vector<Bits>& a, const std::vector<Bits>& b) {
+  using bittool::intersects;
+  for (size_t i = 0; i < a.size(); ++i) {
+    for (size_t j = i + 1; j < a.size(); ++j) {
+      bool cross = intersects(a[i], b[j]) || intersects(b[i], a[j]);
+      if (cross && !intersects(a[i], a[j]) && !intersects(b[i], b[j])) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+void LR1Automaton::finish() {
+  const SymbolInterner& symbols = grammar_set_.symbols();
+  const ProductionTable& table = grammar_set_.productions();
+
+  // 合并后重新处理过的状态可能不再可达
+  std::vector<bool> reachable(states_.size(), false);
+  std::vector<int> stk = {0};
+  reachable[0] = true;
+  while (!stk.empty()) {
+    int index = stk.back();
+    stk.pop_back();
+    for (const auto& [symbol, target] : states_[index].transitions) {
+      if (!reachable[target]) {
+        reachable[target] = true;
+        stk.push_back(target);
+      }
+    }
+  }
+
+  // 按创建顺序重新编号
+  std::vector<std::string> names(states_.size());
+  int counter = 0;
+  for (size_t index = 0; index < states_.size(); ++index) {
+    if (reachable[index]) names[index] = "Item Set " + std::to_string(counter++);
+  }
+
+  cluster_ = ItemCluster(grammar_set_);
+  for (size_t index = 0; index < states_.size(); ++index) {
+    if (!reachable[index]) continue;
+    const State& state = states_[index];
+
+    ItemCluster::State& result = cluster_[names[index]];
+    result.kernel = state.kernel;
+    result.closure = state.kernel.closure(grammar_set_);
+    for (const auto& [symbol, target] : state.transitions) {
+      result.goto_table[symbols.name(symbol)] = names[target];
+    }
+
+    // 完成项目的向前看符号
+    auto& reductions = lookahead_[names[index]];
+    for (const auto& [key, bits] : closure(state)) {
+      const int prod = static_cast<int>(key >> 32);
+      if (static_cast<uint32_t>(key) != table.length(prod)) continue;
+      std::vector<SymbolId>& ids = reductions[prod];
+      bittool::for_each(bits, [&](size_t index) { ids.push_back(grammar_set_.terminal_ids()[index]); });
+    }
+  }
+}
@@ -0,0 +1,66 @@
+#ifndef LR1_HPP
+#define LR1_HPP
+
+#include "item.hpp"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// LR(1) 自动机
+// 状态的核由 LR(0) 项目（Item）和每个项目的向前看符号集合组成
+// merge = false 时为规范 LR(1)：只有核与向前看符号完全相同的状态才合并
+// merge = true  时按 Pager 的弱相容条件合并同核状态：
+//   对核中任意两个项目 i != j，要么两边交叉的向前看集合不相交，要么某一边自身的 i、j 已经相交，
+//   满足时合并不会引入规范 LR(1) 中没有的归约-归约冲突，状态数接近 LALR
+class LR1Automaton {
+public:
+  // 在文法集上构建（与传入的文法集共享符号表和产生式表）
+  LR1Automaton(const GrammarSet& grammar_set, bool merge);
+
+  // 以 ItemCluster 的形式给出自动机（只含 LR(0) 核心，状态名为 "Item Set N"，0 为起始状态）
+  const ItemCluster& cluster() const { return cluster_; }
+
+  // 状态 state 中按产生式 production（产生式表编号）归约时的向前看符号，按符号 id 升序
+  const std::vector<SymbolId>& lookahead(const std::string& state, int production) const;
+
+  // 状态数
+  size_t state_count() const { return cluster_.states().size(); }
+
+private:
+  using Bits = bittool::Bits;
+
+  // 构建过程中的状态
+  struct State {
+    ItemSet kernel;                              // 核（LR(0) 项目）
+    std::vector<uint64_t> core;                  // 核的规范键（项目排序后）
+    std::vector<Bits> lookaheads;                // 与 core 对齐的向前看符号集合
+    std::unordered_map<SymbolId, int> transitions; // 符号 id -> 目标状态
+  };
+
+  GrammarSet grammar_set_;
+  bool merge_;
+  size_t terminal_count_ = 0;                    // 向前看位集按终结符编号
+  std::vector<State> states_;
+  std::unordered_map<std::vector<uint64_t>, std::vector<int>, ItemSet::KeyHash> core_index_; // 核 -> 同核状态
+
+  ItemCluster cluster_;
+  std::unordered_map<std::string, std::unordered_map<int, std::vector<SymbolId>>> lookahead_; // 状态名 -> 产生式 -> 向前看
+
+  // 带向前看符号的闭包：项目键 -> 向前看集合
+  std::unordered_map<uint64_t, Bits> closure(const State& state) const;
+
+  // 处理状态 index 的所有转移
+  void expand(int index, std::vector<int>& worklist);
+
+  // 找到可以接纳核 core / 向前看 lookaheads 的状态，没有时返回 -1
+  int find(const std::vector<uint64_t>& core, const std::vector<Bits>& lookaheads) const;
+
+  // Pager 弱相容
+  static bool compatible(const std::vector<Bits>& a, const std::vector<Bits>& b);
+
+  // 去掉不可达状态，重新编号并生成 cluster_ 和 lookahead_
+  void finish();
+};
+
+#endif // LR1_HPP
@@ -0,0 +1,48 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// 只读内存映射文件（Windows 下用 CreateFileMapping，其它平台用 mmap）
+// 不可复制，可移动；析构时解除映射
+class MappedFile {
+public:
+  // 默认构造函数：未打开
+  MappedFile() = default;
+
+  // 打开并映射文件，失败时 is_open() 为 false
+  explicit MappedFile(const std::string& filename);
+
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile(MappedFile&& other) noexcept;
+  MappedFile& operator=(MappedFile&& other) noexcept;
+
+  // 打开并映射文件（先关闭已打开的文件）
+  bool open(const std::string& filename);
+
+  // 解除映射并关闭文件
+  void close();
+
+  bool is_open() const { return data_ != nullptr; }
+  const uint8_t* data() const { return data_; }
+  size_t size() const { return size_; }
+
+private:
+  const uint8_t* data_ = nullptr;
+  size_t size_ = 0;
+#ifdef _WIN32
+  void* file_ = nullptr;    // HANDLE
+  void* mapping_ = nullptr; // HANDLE
+#else
+  int fd_ = -1;
+#endif
+
+  void swap(MappedFile& other) noexcept;
+};
+
+#endif // MAPPED_FILE_HPP
@@ -0,0 +1,313 @@
+#include "mips_selector.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include "utils/json.hpp"
+
+namespace {
+
+const std::string IDENTIFIER_CLASS = "[a-zA-Z_][a-zA-Z0-9_]*";
+const std::string DIGITS_CLASS = "\\d+";
+
+bool is_word_char(char c) {
+  return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+bool is_digits(std::string_view text) {
+  return !text.empty() && std::all_of(text.begin(), text.end(), [](char c) { return std::isdigit(static_cast<unsigned char>(c)); });
+}
+
+bool is_identifier(std::string_view text) {
+  return !text.empty() && !std::isdigit(static_cast<unsigned char>(text[0])) &&
+         std::all_of(text.begin(), text.end(), is_word_char);
+}
+
+// 按三地址代码的记号边界切分模式中的一段字面文本：单词、关系运算符、单个标点
+std::vector<std::string> split_literal(const std::string& text) {
+  std::vector<std::string> tokens;
+  size_t i = 0;
+  while (i < text.size()) {
+    if (std::isspace(static_cast<unsigned char>(text[i]))) {
+      ++i;
+    } else if (is_word_char(text[i])) {
+      size_t j = i;
+      while (j < text.size() && is_word_char(text[j])) ++j;
+      tokens.push_back(text.substr(i, j - i));
+      i = j;
+    } else if (i + 1 < text.size() && text[i + 1] == '=' && std::string("<>=!").find(text[i]) != std::string::npos) {
+      tokens.push_back(text.substr(i, 2));
+      i += 2;
+    } else {
+      tokens.push_back(text.substr(i, 1));
+      ++i;
+    }
+  }
+  return tokens;
+}
+
+} // namespace
+
+void MipsSelector::load(const std::string& filename) {
+  std::ifstream in(filename);
+  if (!in.is_open()) {
+    throw std::runtime_error("[Code] 无法打开 json 文件: " + filename);
+  }
+
+  nlohmann::json j;
+  in >> j;
+
+  struct Entry {
+    int priority;
+    std::string name;
+    std::string pattern;
+    std::string replacement;
+  };
+  std::vector<Entry> entries;
+  for (const auto& [priority_str, rule_group] : j.items()) {
+    int priority = std::stoi(priority_str);
+    for (const auto& [rule_name, rule_obj] : rule_group.items()) {
+      entries.push_back({ priority, rule_name, rule_obj["pattern"], rule_obj["replacement"] });
+    }
+  }
+  std::stable_sort(entries.begin(), entries.end(),
+                   [](const Entry& a, const Entry& b) { return a.priority < b.priority; });
+
+  clear();
+  for (const auto& entry : entries) {
+    add_rule(entry.name, entry.pattern, entry.replacement);
+  }
+}
+
+void MipsSelector::add_rule(const std::string& name, const std::string& pattern, const std::string& replacement) {
+  Rule rule;
+  rule.name = name;
+  if (!compile_pattern(pattern, rule.atoms, rule.groups)) {
+    rule.atoms.clear();
+    rule.use_regex = true;
+    rule.regex = std::regex("^" + pattern);
+    rule.groups = static_cast<int>(rule.regex.mark_count());
+  }
+  std::vector<std::string> prefixes(rule.groups);
+  for (size_t i = 0, group = 0; i < rule.atoms.size(); ++i) {
+    if (rule.atoms[i].kind != Atom::LITERAL && rule.atoms[i].capture) prefixes[group++] = rule.atoms[i].text;
+  }
+  rule.lines = compile_template(replacement, prefixes);
+  rules_.push_back(std::move(rule));
+}
+
+size_t MipsSelector::regex_rule_count() const {
+  return std::count_if(rules_.begin(), rules_.end(), [](const Rule& rule) { return rule.use_regex; });
+}
+
+bool MipsSelector::compile_pattern(const std::string& pattern, std::vector<Atom>& atoms, int& groups) {
+  atoms.clear();
+  groups = 0;
+  std::string literal;  // 尚未切分的字面文本
+  bool after_class = false;
+
+  auto flush = [&]() {
+    for (auto& token : split_literal(literal)) {
+      atoms.push_back({ Atom::LITERAL, std::move(token), false });
+    }
+    literal.clear();
+  };
+
+  // 字符类紧跟在单词字符后面时（如 t(\d+)），这些字符作为同一个记号的前缀
+  auto add_class = [&](Atom::Kind kind, bool capture) {
+    size_t start = literal.size();
+    while (start > 0 && is_word_char(literal[start - 1])) --start;
+    std::string prefix = literal.substr(start);
+    literal.erase(start);
+    flush();
+    atoms.push_back({ kind, std::move(prefix), capture });
+    if (capture) ++groups;
+    after_class = true;
+  };
+
+  auto class_at = [&](size_t i, Atom::Kind& kind) -> size_t {
+    if (pattern.compare(i, IDENTIFIER_CLASS.size(), IDENTIFIER_CLASS) == 0) {
+      kind = Atom::IDENTIFIER;
+      return IDENTIFIER_CLASS.size();
+    }
+    if (pattern.compare(i, DIGITS_CLASS.size(), DIGITS_CLASS) == 0) {
+      kind = Atom::DIGITS;
+      return DIGITS_CLASS.size();
+    }
+    return 0;
+  };
+
+  size_t i = 0;
+  while (i < pattern.size()) {
+    Atom::Kind kind;
+    if (pattern.compare(i, 3, "\\s*") == 0 || pattern.compare(i, 3, "\\s+") == 0) {
+      flush();
+      after_class = false;
+      i += 3;
+      continue;
+    }
+    if (pattern[i] == '(') {
+      size_t length = class_at(i + 1, kind);
+      if (length == 0 || i + 1 + length >= pattern.size() || pattern[i + 1 + length] != ')') return false;
+      if (after_class && literal.empty()) return false;
+      add_class(kind, true);
+      i += length + 2;
+      continue;
+    }
+    if (size_t length = class_at(i, kind)) {
+      if (after_class && literal.empty()) return false;
+      add_class(kind, false);
+      i += length;
+      continue;
+    }
+
+    char c = pattern[i];
+    if (c == '\\') {
+      if (i + 1 >= pattern.size()) return false;
+      c = pattern[i + 1];
+      // 转义的字母是 \d \w \b 一类，不是字面字符
+      if (std::isalnum(static_cast<unsigned char>(c))) return false;
+      i += 2;
+    } else {
+      if (std::string(".[](){}*+?|^$").find(c) != std::string::npos) return false;
+      ++i;
+    }
+    // 字符类后面紧跟单词字符时两者属于同一个记号，不支持
+    if (after_class && literal.empty() && is_word_char(c)) return false;
+    after_class = false;
+    literal += c;
+  }
+  flush();
+  return true;
+}
+
+std::vector<MipsSelector::Line> MipsSelector::compile_template(const std::string& replacement,
+                                                               const std::vector<std::string>& prefixes) {
+  const int groups = static_cast<int>(prefixes.size());
+  // 与逐个 regex_replace 的结果相同：$n（1 <= n <= groups）是槽位，\$ 是 '$'，\n 是换行，
+  // 结果按行拆开，空模板或末尾的换行不产生空行
+  std::vector<Line> lines(1);
+  auto slot_at = [&](size_t i) {
+    if (i + 1 >= replacement.size() || replacement[i] != '$') return 0;
+    int n = replacement[i + 1] - '0';
+    return n >= 1 && n <= std::min(groups, 9) ? n : 0;
+  };
+  auto append = [&](char c) {
+    Line& line = lines.back();
+    if (line.pieces.empty() || line.pieces.back().slot != 0) line.pieces.push_back({});
+    line.pieces.back().text += c;
+    if (c == ':') line.label = true;
+  };
+
+  size_t i = 0;
+  while (i < replacement.size()) {
+    if (int slot = slot_at(i)) {
+      // 前面的文本以 "$" + 前缀结尾时是寄存器槽位，把这段文本并入槽位
+      auto& pieces = lines.back().pieces;
+      const std::string reg = "$" + prefixes[slot - 1];
+      Piece piece{ "", slot, false };
+      if (!pieces.empty() && pieces.back().slot == 0 && pieces.back().text.size() >= reg.size() &&
+          pieces.back().text.compare(pieces.back().text.size() - reg.size(), reg.size(), reg) == 0) {
+        pieces.back().text.resize(pieces.back().text.size() - reg.size());
+        if (pieces.back().text.empty()) pieces.pop_back();
+        piece = { reg, slot, true };
+      }
+      pieces.push_back(std::move(piece));
+      i += 2;
+    } else if (replacement[i] == '\\' && i + 1 < replacement.size() && replacement[i + 1] == '$' && !slot_at(i + 1)) {
+      append('$');
+      i += 2;
+    } else if (replacement[i] == '\\' && i + 1 < replacement.size() && replacement[i + 1] == 'n') {
+      lines.emplace_back();
+      i += 2;
+    } else if (replacement[i] == '\n') {
+      lines.emplace_back();
+      ++i;
+    } else {
+      append(replacement[i]);
+      ++i;
+    }
+  }
+  if (lines.back().pieces.empty()) lines.pop_back();
+  return lines;
+}
+
+bool MipsSelector::match(const std::vector<Atom>& atoms, const std::vector<std::string_view>& tokens,
+                         std::vector<std::string_view>& captures) {
+  if (atoms.size() != tokens.size()) return false;
+  captures.clear();
+  for (size_t i = 0; i < atoms.size(); ++i) {
+    const Atom& atom = atoms[i];
+    std::string_view token = tokens[i];
+    if (atom.kind == Atom::LITERAL) {
+      if (token != atom.text) return false;
+      continue;
+    }
+    if (token.compare(0, atom.text.size(), atom.text) != 0) return false;
+    std::string_view rest = token.substr(atom.text.size());
+    if (atom.kind == Atom::IDENTIFIER ? !is_identifier(rest) : !is_digits(rest)) return false;
+    if (atom.capture) captures.push_back(rest);
+  }
+  return true;
+}
+
+void MipsSelector::emit(const std::vector<Line>& lines, const std::vector<std::string_view>& captures,
+                        const RegisterMap* registers, std::ostream& out) {
+  std::string name;
+  for (const auto& line : lines) {
+    bool label = line.label;
+    for (const auto& piece : line.pieces) {
+      if (piece.slot != 0 && captures[piece.slot - 1].find(':') != std::string_view::npos) label = true;
+    }
+    if (!label) out << "  ";
+    for (const auto& piece : line.pieces) {
+      if (piece.slot == 0) {
+        out << piece.text;
+        continue;
+      }
+      const std::string_view capture = captures[piece.slot - 1];
+      if (piece.reg && registers) {
+        name.assign(piece.text, 1);
+        name += capture;
+        auto it = registers->find(name);
+        if (it != registers->end()) {
+          out << it->second;
+          continue;
+        }
+      }
+      out << piece.text << capture;
+    }
+    out << '\n';
+  }
+}
+
+bool MipsSelector::select(const TacInstruction& instruction, std::ostream& out, const RegisterMap* registers) const {
+  instruction.tokens(tokens_, buffer_);
+
+  std::string text;  // 指令的打印文本，只在有规则退回 std::regex 时生成
+  for (const auto& rule : rules_) {
+    if (!rule.use_regex) {
+      if (!match(rule.atoms, tokens_, captures_)) continue;
+      emit(rule.lines, captures_, registers, out);
+      return true;
+    }
+
+    if (text.empty()) {
+      std::ostringstream oss;
+      oss << instruction;
+      text = oss.str();
+    }
+    std::smatch match;
+    if (!std::regex_match(text, match, rule.regex)) continue;
+    captures_.clear();
+    for (size_t i = 1; i < match.size(); ++i) {
+      captures_.emplace_back(text.data() + match.position(i), match.length(i));
+    }
+    emit(rule.lines, captures_, registers, out);
+    return true;
+  }
+  return false;
+}
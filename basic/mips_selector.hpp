@@ -0,0 +1,100 @@
+#ifndef MIPS_SELECTOR_HPP
+#define MIPS_SELECTOR_HPP
+
+#include <ostream>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "tac.hpp"
+
+// MIPS 指令选择：mips.json 中的规则在加载时编译一次，
+// 模式编译成按记号匹配的序列，直接和 TacInstruction::tokens() 比较；
+// 替换模板预先切成文本片段和 $1, $2 ... 槽位，输出时只做拼接。
+// 模式超出支持的子集时，这条规则退回 std::regex 匹配指令的打印文本，模板仍是预编译的。
+// 模板中紧跟在 '$' 后面的槽位（如 \$$1、$t$1）是寄存器槽位，可以按 RegisterMap 换成分配到的物理寄存器
+class MipsSelector {
+public:
+  // 操作数名字 -> 物理寄存器（如 "t3" -> "$s0"）
+  using RegisterMap = std::unordered_map<std::string, std::string>;
+
+  // 默认构造函数
+  MipsSelector() = default;
+
+  // 读取规则文件 {优先级: {规则名: {pattern, replacement}}}，优先级数值小的先尝试
+  // 文件无法打开时抛出 runtime_error
+  void load(const std::string& filename);
+
+  // 追加一条规则，排在已有规则之后
+  void add_rule(const std::string& name, const std::string& pattern, const std::string& replacement);
+
+  // 清空规则
+  void clear() { rules_.clear(); }
+
+  // 为一条指令选择 MIPS 代码写入 out：标号行顶格，其余缩进两格
+  // registers 不为空时，寄存器槽位按它替换（没有登记的名字仍输出为 $名字）
+  // 没有规则匹配时返回 false，不输出
+  bool select(const TacInstruction& instruction, std::ostream& out, const RegisterMap* registers = nullptr) const;
+
+  // 规则数
+  size_t rule_count() const { return rules_.size(); }
+
+  // 退回 std::regex 的规则数
+  size_t regex_rule_count() const;
+
+private:
+  // 记号模式中的一个元素，匹配恰好一个记号
+  struct Atom {
+    enum Kind { LITERAL, IDENTIFIER, DIGITS } kind = LITERAL;
+    std::string text;      // LITERAL 的记号文本；其余为记号必须带的前缀，如 t(\d+) 的 "t"
+    bool capture = false;  // 是否是捕获组（前缀不计入捕获）
+  };
+
+  // 模板片段：slot 为 0 时是文本，否则是第 slot 个捕获组；
+  // 寄存器槽位的 text 是前面的 "$" 加记号前缀（如 $t$1 的 "$t"），操作数名字为前缀加捕获的文本
+  struct Piece {
+    std::string text;
+    int slot = 0;
+    bool reg = false;
+  };
+
+  // 模板的一行输出
+  struct Line {
+    std::vector<Piece> pieces;
+    bool label = false;  // 文本片段中含 ':'，不缩进
+  };
+
+  struct Rule {
+    std::string name;
+    std::vector<Atom> atoms;  // 记号模式，use_regex 时为空
+    bool use_regex = false;
+    std::regex regex;         // 退回时使用的正则
+    int groups = 0;           // 捕获组数
+    std::vector<Line> lines;  // 预编译的替换模板
+  };
+
+  std::vector<Rule> rules_;
+
+  // 匹配时复用的缓冲区
+  mutable std::vector<std::string_view> tokens_;
+  mutable std::vector<std::string_view> captures_;
+  mutable std::string buffer_;
+
+  // 把模式编译成记号序列，超出子集时返回 false
+  static bool compile_pattern(const std::string& pattern, std::vector<Atom>& atoms, int& groups);
+
+  // 把替换模板切成行和片段，只有 1..groups 的 $n 是槽位；prefixes 为各捕获组在记号中的前缀
+  static std::vector<Line> compile_template(const std::string& replacement, const std::vector<std::string>& prefixes);
+
+  // 记号模式匹配，captures 为各捕获组的文本
+  static bool match(const std::vector<Atom>& atoms, const std::vector<std::string_view>& tokens,
+                    std::vector<std::string_view>& captures);
+
+  // 按模板输出
+  static void emit(const std::vector<Line>& lines, const std::vector<std::string_view>& captures,
+                   const RegisterMap* registers, std::ostream& out);
+};
+
+#endif // MIPS_SELECTOR_HPP
@@ -0,0 +1,270 @@
+#include "parse_table.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+// 建立 符号 id -> 列 的索引
+static std::vector<int32_t> make_columns(ArrayView<SymbolId> symbols) {
+  SymbolId max_id = symbols.empty() ? -1 : *std::max_element(symbols.begin(), symbols.end());
+  std::vector<int32_t> columns(max_id + 1, -1);
+  for (size_t i = 0; i < symbols.size(); ++i) {
+    columns[symbols[i]] = static_cast<int32_t>(i);
+  }
+  return columns;
+}
+
+ParseTable::ParseTable(size_t state_count, const std::vector<SymbolId>& terminals, const std::vector<SymbolId>& non_terminals)
+  : states_(state_count), action_column_(make_columns(terminals)), goto_column_(make_columns(non_terminals)),
+    terminal_storage_(terminals), non_terminal_storage_(non_terminals),
+    action_storage_(state_count * terminals.size(), 0), goto_storage_(state_count * non_terminals.size(), -1) {
+  bind();
+}
+
+ParseTable::ParseTable(size_t state_count, ArrayView<SymbolId> terminals, ArrayView<SymbolId> non_terminals,
+                       ArrayView<Entry> action, ArrayView<int32_t> goto_table, std::vector<Conflict> conflicts)
+  : states_(state_count), terminals_(terminals), non_terminals_(non_terminals),
+    action_column_(make_columns(terminals)), goto_column_(make_columns(non_terminals)),
+    action_(action), goto_(goto_table), conflicts_(std::move(conflicts)), owned_(false) {}
+
+ParseTable::ParseTable(const ParseTable& other)
+  : states_(other.states_), terminals_(other.terminals_), non_terminals_(other.non_terminals_),
+    action_column_(other.action_column_), goto_column_(other.goto_column_),
+    action_(other.action_), goto_(other.goto_), conflicts_(other.conflicts_), owned_(other.owned_),
+    terminal_storage_(other.terminal_storage_), non_terminal_storage_(other.non_terminal_storage_),
+    action_storage_(other.action_storage_), goto_storage_(other.goto_storage_) {
+  if (owned_) bind();
+}
+
+ParseTable& ParseTable::operator=(const ParseTable& other) {
+  if (this != &other) {
+    ParseTable copy(other);
+    *this = std::move(copy);
+  }
+  return *this;
+}
+
+void ParseTable::bind() {
+  terminals_ = terminal_storage_;
+  non_terminals_ = non_terminal_storage_;
+  action_ = action_storage_;
+  goto_ = goto_storage_;
+}
+
+void ParseTable::own() {
+  if (owned_) return;
+  terminal_storage_.assign(terminals_.begin(), terminals_.end());
+  non_terminal_storage_.assign(non_terminals_.begin(), non_terminals_.end());
+  action_storage_.assign(action_.begin(), action_.end());
+  goto_storage_.assign(goto_.begin(), goto_.end());
+  owned_ = true;
+  bind();
+}
+
+void ParseTable::set_action(int state, SymbolId terminal, Entry entry) {
+  int column = column_of(action_column_, terminal);
+  if (state < 0 || static_cast<size_t>(state) >= states_ || column < 0) {
+    throw std::out_of_range("ParseTable::set_action: cell out of range.");
+  }
+  own();
+  action_storage_[state * terminals_.size() + column] = entry;
+}
+
+void ParseTable::set_goto(int state, SymbolId non_terminal, int target) {
+  int column = column_of(goto_column_, non_terminal);
+  if (state < 0 || static_cast<size_t>(state) >= states_ || column < 0) {
+    throw std::out_of_range("ParseTable::set_goto: cell out of range.");
+  }
+  own();
+  goto_storage_[state * non_terminals_.size() + column] = target;
+}
+
+void ParseTable::add_conflict(int state, SymbolId terminal, const std::vector<Entry>& actions) {
+  conflicts_.push_back({state, terminal, actions});
+  set_action(state, terminal, pack(EMPTY, static_cast<uint32_t>(conflicts_.size())));
+}
+
+size_t ParseTable::bytes() const {
+  size_t total = sizeof(*this);
+  // 引用外部数组时按数组长度计
+  if (owned_) {
+    total += terminal_storage_.capacity() * sizeof(SymbolId) + non_terminal_storage_.capacity() * sizeof(SymbolId);
+    total += action_storage_.capacity() * sizeof(Entry) + goto_storage_.capacity() * sizeof(int32_t);
+  } else {
+    total += terminals_.size() * sizeof(SymbolId) + non_terminals_.size() * sizeof(SymbolId);
+    total += action_.size() * sizeof(Entry) + goto_.size() * sizeof(int32_t);
+  }
+  total += action_column_.capacity() * sizeof(int32_t) + goto_column_.capacity() * sizeof(int32_t);
+  for (const auto& conflict : conflicts_) {
+    total += sizeof(Conflict) + conflict.actions.capacity() * sizeof(Entry);
+  }
+  return total;
+}
+
+// ===== CompressedParseTable =====
+
+// 行位移打包：为每一行找到第一个不与已占用位置冲突的位移
+// rows[state] 为 (列, 值) 列表，按格子数从多到少依次放置
+template <typename T>
+static void pack_rows(const std::vector<std::vector<std::pair<int, T>>>& rows, T empty,
+                      std::vector<int32_t>& base, std::vector<T>& table, std::vector<int32_t>& check) {
+  base.assign(rows.size(), 0);
+  table.clear();
+  check.clear();
+
+  std::vector<size_t> order(rows.size());
+  for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return rows[a].size() > rows[b].size();
+  });
+
+  for (size_t state : order) {
+    const auto& row = rows[state];
+    if (row.empty()) continue;
+
+    int32_t offset = 0;
+    while (true) {
+      bool fits = true;
+      for (const auto& [column, _] : row) {
+        size_t index = offset + column;
+        if (index < check.size() && check[index] != -1) {
+          fits = false;
+          break;
+        }
+      }
+      if (fits) break;
+      ++offset;
+    }
+
+    base[state] = offset;
+    for (const auto& [column, value] : row) {
+      size_t index = offset + column;
+      if (index >= check.size()) {
+        check.resize(index + 1, -1);
+        table.resize(index + 1, empty);
+      }
+      check[index] = static_cast<int32_t>(state);
+      table[index] = value;
+    }
+  }
+}
+
+CompressedParseTable::CompressedParseTable(const ParseTable& table, bool exact)
+  : states_(table.state_count()), exact_(exact),
+    action_column_(table.action_columns()), goto_column_(table.goto_columns()),
+    conflicts_(table.conflicts()) {
+  const auto& terminals = table.terminals();
+  const auto& non_terminals = table.non_terminals();
+
+  // ACTION：每个状态取出现最多的归约作为默认归约，其余非空格子进入打包
+  default_reduce_.assign(states_, 0);
+  error_stride_ = exact_ ? (terminals.size() + 7) / 8 : 0;
+  error_bits_.assign(states_ * error_stride_, 0);
+
+  std::vector<std::vector<std::pair<int, ParseTable::Entry>>> action_rows(states_);
+  for (size_t state = 0; state < states_; ++state) {
+    std::vector<std::pair<ParseTable::Entry, int>> reduce_counts;
+    for (SymbolId terminal : terminals) {
+      ParseTable::Entry entry = table.action(static_cast<int>(state), terminal);
+      if (ParseTable::kind(entry) != ParseTable::REDUCE) continue;
+      auto it = std::find_if(reduce_counts.begin(), reduce_counts.end(), [&](const auto& p) { return p.first == entry; });
+      if (it == reduce_counts.end()) reduce_counts.emplace_back(entry, 1);
+      else it->second++;
+    }
+    ParseTable::Entry best = 0;
+    int best_count = 0;
+    for (const auto& [entry, count] : reduce_counts) {
+      if (count > best_count) {
+        best = entry;
+        best_count = count;
+      }
+    }
+    default_reduce_[state] = best;
+
+    for (size_t column = 0; column < terminals.size(); ++column) {
+      ParseTable::Entry entry = table.action(static_cast<int>(state), terminals[column]);
+      if (ParseTable::is_error(entry)) {
+        if (best != 0 && exact_) {
+          error_bits_[state * error_stride_ + column / 8] |= static_cast<uint8_t>(1u << (column % 8));
+        }
+        continue;
+      }
+      if (entry == best) continue;
+      action_rows[state].emplace_back(static_cast<int>(column), entry);
+      action_entries_++;
+    }
+  }
+  pack_rows<ParseTable::Entry>(action_rows, 0, action_base_, action_table_, action_check_);
+
+  // GOTO：每个非终结符取出现最多的目标作为默认目标
+  // exact 时把 -1 也计入，保证未定义的格子仍然查不到；否则与 yacc 一样只统计有效目标
+  default_goto_.assign(non_terminals.size(), -1);
+  for (size_t column = 0; column < non_terminals.size(); ++column) {
+    std::vector<std::pair<int, int>> counts;
+    for (size_t state = 0; state < states_; ++state) {
+      int target = table.goto_state(static_cast<int>(state), non_terminals[column]);
+      if (target < 0 && !exact_) continue;
+      auto it = std::find_if(counts.begin(), counts.end(), [&](const auto& p) { return p.first == target; });
+      if (it == counts.end()) counts.emplace_back(target, 1);
+      else it->second++;
+    }
+    int best_count = 0;
+    for (const auto& [target, count] : counts) {
+      if (count > best_count) {
+        default_goto_[column] = target;
+        best_count = count;
+      }
+    }
+  }
+
+  std::vector<std::vector<std::pair<int, int32_t>>> goto_rows(states_);
+  for (size_t state = 0; state < states_; ++state) {
+    for (size_t column = 0; column < non_terminals.size(); ++column) {
+      int target = table.goto_state(static_cast<int>(state), non_terminals[column]);
+      if (target == default_goto_[column] || (target < 0 && !exact_)) continue;
+      goto_rows[state].emplace_back(static_cast<int>(column), target);
+      goto_entries_++;
+    }
+  }
+  pack_rows<int32_t>(goto_rows, -1, goto_base_, goto_table_, goto_check_);
+}
+
+ParseTable::Entry CompressedParseTable::action(int state, SymbolId terminal) const {
+  if (state < 0 || static_cast<size_t>(state) >= states_) return 0;
+  int column = column_of(action_column_, terminal);
+  if (column < 0) return 0;
+
+  size_t index = action_base_[state] + column;
+  if (index < action_check_.size() && action_check_[index] == state) {
+    return action_table_[index];
+  }
+
+  ParseTable::Entry fallback = default_reduce_[state];
+  if (fallback != 0 && exact_ && (error_bits_[state * error_stride_ + column / 8] >> (column % 8) & 1)) {
+    return 0;
+  }
+  return fallback;
+}
+
+int CompressedParseTable::goto_state(int state, SymbolId non_terminal) const {
+  if (state < 0 || static_cast<size_t>(state) >= states_) return -1;
+  int column = column_of(goto_column_, non_terminal);
+  if (column < 0) return -1;
+
+  size_t index = goto_base_[state] + column;
+  if (index < goto_check_.size() && goto_check_[index] == state) {
+    return goto_table_[index];
+  }
+  return default_goto_[column];
+}
+
+size_t CompressedParseTable::bytes() const {
+  size_t total = sizeof(*this);
+  total += (action_column_.capacity() + goto_column_.capacity()) * sizeof(int32_t);
+  total += (action_base_.capacity() + action_check_.capacity()) * sizeof(int32_t);
+  total += (action_table_.capacity() + default_reduce_.capacity()) * sizeof(ParseTable::Entry);
+  total += error_bits_.capacity();
+  total += (goto_base_.capacity() + goto_table_.capacity() + goto_check_.capacity() + default_goto_.capacity()) * sizeof(int32_t);
+  for (const auto& conflict : conflicts_) {
+    total += sizeof(ParseTable::Conflict) + conflict.actions.capacity() * sizeof(ParseTable::Entry);
+  }
+  return total;
+}
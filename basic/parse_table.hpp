@@ -0,0 +1,204 @@
+#ifndef PARSE_TABLE_HPP
+#define PARSE_TABLE_HPP
+
+#include "symbol_interner.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+// 只读数组视图：指向 ParseTable 自己的数组，或生成的头文件、映射的二进制文件中的数组
+template <typename T>
+class ArrayView {
+public:
+  ArrayView() = default;
+  ArrayView(const T* data, size_t size) : data_(data), size_(size) {}
+  ArrayView(const std::vector<T>& vector) : data_(vector.data()), size_(vector.size()) {}
+
+  const T* data() const { return data_; }
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  const T* begin() const { return data_; }
+  const T* end() const { return data_ + size_; }
+  const T& operator[](size_t i) const { return data_[i]; }
+
+  friend bool operator==(const ArrayView& a, const ArrayView& b) {
+    return a.size_ == b.size_ && std::equal(a.begin(), a.end(), b.begin());
+  }
+  friend bool operator!=(const ArrayView& a, const ArrayView& b) { return !(a == b); }
+
+private:
+  const T* data_ = nullptr;
+  size_t size_ = 0;
+};
+
+// 编译后的分析表：由 SLRTable 在 build()/read_csv()/eliminate_conflict() 之后生成，只读
+// ACTION 为 state x 终结符 的连续数组，GOTO 为 state x 非终结符 的连续数组
+// 每个 ACTION 格子是一个 32 位整数：高 2 位为动作类型，低 30 位为目标
+class ParseTable {
+public:
+  using Entry = uint32_t;
+
+  // 动作类型（高 2 位）
+  enum Kind : uint32_t { EMPTY = 0, SHIFT = 1, REDUCE = 2, ACCEPT = 3 };
+
+  static constexpr Entry TARGET_MASK = (1u << 30) - 1;
+
+  // 冲突格子：保留全部动作，供诊断使用
+  struct Conflict {
+    int state;
+    SymbolId symbol;
+    std::vector<Entry> actions;
+  };
+
+  static constexpr Entry pack(Kind kind, uint32_t target) { return (static_cast<Entry>(kind) << 30) | (target & TARGET_MASK); }
+  static constexpr Kind kind(Entry entry) { return static_cast<Kind>(entry >> 30); }
+  static constexpr uint32_t target(Entry entry) { return entry & TARGET_MASK; }
+
+  // 空格子为 0 表示出错；类型为 EMPTY 但低位非 0 表示冲突，低位为冲突下标 + 1
+  static constexpr bool is_error(Entry entry) { return entry == 0; }
+  static constexpr bool is_conflict(Entry entry) { return kind(entry) == EMPTY && entry != 0; }
+
+  // 默认构造函数：空表
+  ParseTable() = default;
+
+  // 按状态数和终结符/非终结符列构造，所有格子为空
+  ParseTable(size_t state_count, const std::vector<SymbolId>& terminals, const std::vector<SymbolId>& non_terminals);
+
+  // 直接引用已排好的列与 ACTION/GOTO 数组，不复制（布局与 actions()/gotos() 相同）
+  // 数组由调用者保证在表的生命周期内有效；之后修改格子时先复制成自己的数组
+  ParseTable(size_t state_count, ArrayView<SymbolId> terminals, ArrayView<SymbolId> non_terminals,
+             ArrayView<Entry> action, ArrayView<int32_t> goto_table, std::vector<Conflict> conflicts);
+
+  ParseTable(const ParseTable& other);
+  ParseTable& operator=(const ParseTable& other);
+  ParseTable(ParseTable&&) = default;
+  ParseTable& operator=(ParseTable&&) = default;
+
+  // 设置 ACTION/GOTO 格子
+  void set_action(int state, SymbolId terminal, Entry entry);
+  void set_goto(int state, SymbolId non_terminal, int target);
+
+  // 登记冲突格子，格子内写入冲突标记
+  void add_conflict(int state, SymbolId terminal, const std::vector<Entry>& actions);
+
+  // 查询 ACTION，越界或未知符号返回 0（出错）
+  Entry action(int state, SymbolId terminal) const {
+    if (state < 0 || static_cast<size_t>(state) >= states_) return 0;
+    int column = column_of(action_column_, terminal);
+    return column < 0 ? 0 : action_[state * terminals_.size() + column];
+  }
+
+  // 查询 GOTO，没有目标返回 -1
+  int goto_state(int state, SymbolId non_terminal) const {
+    if (state < 0 || static_cast<size_t>(state) >= states_) return -1;
+    int column = column_of(goto_column_, non_terminal);
+    return column < 0 ? -1 : goto_[state * non_terminals_.size() + column];
+  }
+
+  // 冲突格子对应的记录
+  const Conflict& conflict(Entry entry) const { return conflicts_[target(entry) - 1]; }
+  const std::vector<Conflict>& conflicts() const { return conflicts_; }
+
+  // 按行存放的 ACTION/GOTO 数组
+  ArrayView<Entry> actions() const { return action_; }
+  ArrayView<int32_t> gotos() const { return goto_; }
+
+  // 符号 id -> 列（CompressedParseTable 复用）
+  const std::vector<int32_t>& action_columns() const { return action_column_; }
+  const std::vector<int32_t>& goto_columns() const { return goto_column_; }
+
+  size_t state_count() const { return states_; }
+  ArrayView<SymbolId> terminals() const { return terminals_; }
+  ArrayView<SymbolId> non_terminals() const { return non_terminals_; }
+  bool empty() const { return states_ == 0; }
+
+  // 占用的字节数
+  size_t bytes() const;
+
+private:
+  size_t states_ = 0;                   // 状态数
+  ArrayView<SymbolId> terminals_;       // ACTION 列 -> 符号 id
+  ArrayView<SymbolId> non_terminals_;   // GOTO 列 -> 符号 id
+  std::vector<int32_t> action_column_;  // 符号 id -> ACTION 列，-1 表示不是终结符
+  std::vector<int32_t> goto_column_;    // 符号 id -> GOTO 列，-1 表示不是非终结符
+  ArrayView<Entry> action_;             // ACTION 数组，states_ * terminals_.size()
+  ArrayView<int32_t> goto_;             // GOTO 数组，states_ * non_terminals_.size()，-1 为空
+  std::vector<Conflict> conflicts_;     // 冲突格子
+
+  // 视图指向自己的数组时（owned_ 为真）的存放处；引用外部数组时为空
+  bool owned_ = true;
+  std::vector<SymbolId> terminal_storage_;
+  std::vector<SymbolId> non_terminal_storage_;
+  std::vector<Entry> action_storage_;
+  std::vector<int32_t> goto_storage_;
+
+  // 视图重新指向自己的数组
+  void bind();
+
+  // 引用外部数组时复制成自己的数组（修改格子之前调用）
+  void own();
+
+  static int column_of(const std::vector<int32_t>& columns, SymbolId symbol) {
+    return symbol < 0 || static_cast<size_t>(symbol) >= columns.size() ? -1 : columns[symbol];
+  }
+};
+
+// 压缩分析表：行位移（comb vector）打包 + 每个状态的默认归约，思路同 yacc/bison
+// exact 为 true 时额外保存默认归约状态的出错位图，查询结果与 ParseTable 完全一致；
+// 为 false 时与 yacc 一样，出错格子可能先返回默认归约，错误在下一次移进前被发现
+class CompressedParseTable {
+public:
+  // 默认构造函数：空表
+  CompressedParseTable() = default;
+
+  // 由稠密表压缩
+  explicit CompressedParseTable(const ParseTable& table, bool exact = true);
+
+  // 查询 ACTION，语义同 ParseTable::action
+  ParseTable::Entry action(int state, SymbolId terminal) const;
+
+  // 查询 GOTO，语义同 ParseTable::goto_state
+  int goto_state(int state, SymbolId non_terminal) const;
+
+  // 冲突格子对应的记录
+  const ParseTable::Conflict& conflict(ParseTable::Entry entry) const { return conflicts_[ParseTable::target(entry) - 1]; }
+
+  size_t state_count() const { return states_; }
+  bool exact() const { return exact_; }
+
+  // 显式保存的格子数（不含默认动作）
+  size_t action_entries() const { return action_entries_; }
+  size_t goto_entries() const { return goto_entries_; }
+
+  // 占用的字节数
+  size_t bytes() const;
+
+private:
+  size_t states_ = 0;
+  bool exact_ = true;
+  std::vector<int32_t> action_column_;        // 符号 id -> ACTION 列
+  std::vector<int32_t> goto_column_;          // 符号 id -> GOTO 列
+
+  std::vector<int32_t> action_base_;          // 每个状态的行在 action_table_ 中的位移
+  std::vector<ParseTable::Entry> action_table_; // 打包后的 ACTION 格子
+  std::vector<int32_t> action_check_;         // 每个位置属于哪个状态，-1 为空
+  std::vector<ParseTable::Entry> default_reduce_; // 每个状态的默认归约，0 表示没有
+  std::vector<uint8_t> error_bits_;           // exact 时：默认归约状态中原本出错的格子
+  size_t error_stride_ = 0;                   // 每个状态的位图字节数
+
+  std::vector<int32_t> goto_base_;            // 每个状态的行在 goto_table_ 中的位移
+  std::vector<int32_t> goto_table_;           // 打包后的 GOTO 格子
+  std::vector<int32_t> goto_check_;           // 每个位置属于哪个状态，-1 为空
+  std::vector<int32_t> default_goto_;         // 每个非终结符的默认目标
+
+  std::vector<ParseTable::Conflict> conflicts_; // 冲突格子
+
+  size_t action_entries_ = 0;
+  size_t goto_entries_ = 0;
+
+  static int column_of(const std::vector<int32_t>& columns, SymbolId symbol) {
+    return symbol < 0 || static_cast<size_t>(symbol) >= columns.size() ? -1 : columns[symbol];
+  }
+};
+
+#endif // PARSE_TABLE_HPP
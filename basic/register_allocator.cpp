@@ -0,0 +1,390 @@
+#include "register_allocator.hpp"
+
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+#include <unordered_set>
+
+bool Liveness::LiveSet::merge(const LiveSet& other) {
+  bool changed = false;
+  for (size_t w = 0; w < bits_.size(); ++w) {
+    uint64_t merged = bits_[w] | other.bits_[w];
+    changed |= merged != bits_[w];
+    bits_[w] = merged;
+  }
+  return changed;
+}
+
+Liveness::Liveness(const TacCode& code, const Predicate& is_candidate) : cfg_(code) {
+  const size_t n = code.size();
+  defs_.assign(n, -1);
+  uses_.resize(n);
+
+  auto value_of = [&](const TacOperand& operand) {
+    auto [it, inserted] = values_.emplace(operand.name, static_cast<int>(names_.size()));
+    if (inserted) names_.push_back(operand.name);
+    return it->second;
+  };
+
+  // 编号、定值与引用
+  std::vector<const TacOperand*> operands;
+  for (size_t i = 0; i < n; ++i) {
+    const TacInstruction& instruction = code[i];
+    instruction.used(operands);
+    for (const TacOperand* operand : operands) {
+      if (is_candidate(*operand)) uses_[i].push_back(value_of(*operand));
+    }
+    const TacOperand* defined = instruction.defined();
+    if (defined && is_candidate(*defined)) defs_[i] = value_of(*defined);
+  }
+
+  // 块内的引用（先于定值）与定值
+  const size_t blocks = block_count();
+  const size_t values = names_.size();
+  std::vector<LiveSet> gen(blocks, LiveSet(values));
+  std::vector<LiveSet> kill(blocks, LiveSet(values));
+  for (size_t b = 0; b < blocks; ++b) {
+    for (size_t i = block_begin(b); i < block_end(b); ++i) {
+      for (int use : uses_[i]) {
+        if (!kill[b].contains(use)) gen[b].insert(use);
+      }
+      if (defs_[i] >= 0) kill[b].insert(defs_[i]);
+    }
+  }
+
+  // 逆序迭代到不动点：out = ∪ in(后继)，in = gen ∪ (out - kill)
+  live_in_.assign(blocks, LiveSet(values));
+  live_out_.assign(blocks, LiveSet(values));
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (size_t b = blocks; b-- > 0;) {
+      for (size_t next : successors(b)) live_out_[b].merge(live_in_[next]);
+      LiveSet in = gen[b];
+      live_out_[b].for_each([&](int v) {
+        if (!kill[b].contains(v)) in.insert(v);
+      });
+      changed |= live_in_[b].merge(in);
+    }
+  }
+}
+
+int Liveness::value(const std::string& name) const {
+  auto it = values_.find(name);
+  return it == values_.end() ? -1 : it->second;
+}
+
+const std::vector<std::string> LinearScanAllocator::CALLER_SAVED = {
+  "$t0", "$t1", "$t2", "$t3", "$t4", "$t5", "$t6", "$t7", "$t8", "$t9"
+};
+
+const std::vector<std::string> LinearScanAllocator::CALLEE_SAVED = {
+  "$s0", "$s1", "$s2", "$s3", "$s4", "$s5", "$s6", "$s7"
+};
+
+LinearScanAllocator::LinearScanAllocator(std::vector<std::string> caller_saved, std::vector<std::string> callee_saved)
+  : caller_saved_(std::move(caller_saved)), callee_saved_(std::move(callee_saved)) {}
+
+RegisterAssignment LinearScanAllocator::allocate(const TacCode& code, const Liveness& liveness) const {
+  // 活跃区间：指令 i 之前记为 2i，之后记为 2i + 1，
+  // 这样最后一次引用在 i 的值和在 i 定值的值不重叠，可以共用寄存器
+  struct Interval {
+    int value;
+    int start = -1;
+    int end = -1;
+    bool across_call = false;  // 在某个 CALL 之后仍然活跃（不含 CALL 本身的结果）
+    int reg = -1;              // 寄存器在 caller_saved_ + callee_saved_ 中的下标
+  };
+  const int values = static_cast<int>(liveness.value_count());
+  std::vector<Interval> intervals(values);
+  for (int v = 0; v < values; ++v) intervals[v].value = v;
+  auto extend = [&](int v, int point) {
+    Interval& interval = intervals[v];
+    if (interval.start < 0 || point < interval.start) interval.start = point;
+    interval.end = std::max(interval.end, point);
+  };
+  // 区间取所有活跃点的包络：块内的点一定落在定值/引用点与块首尾之间
+  for (size_t b = 0; b < liveness.block_count(); ++b) {
+    const int first = static_cast<int>(2 * liveness.block_begin(b));
+    const int last = static_cast<int>(2 * liveness.block_end(b) - 1);
+    liveness.live_in(b).for_each([&](int v) { extend(v, first); });
+    liveness.live_out(b).for_each([&](int v) { extend(v, last); });
+    liveness.walk_backward(b, [&](size_t i, const Liveness::LiveSet& live) {
+      if (liveness.def(i) >= 0) extend(liveness.def(i), static_cast<int>(2 * i + 1));
+      for (int use : liveness.uses(i)) extend(use, static_cast<int>(2 * i));
+      if (code[i].op != TacOp::CALL) return;
+      live.for_each([&](int v) {
+        if (v != liveness.def(i)) intervals[v].across_call = true;
+      });
+    });
+  }
+
+  std::vector<Interval*> order;
+  for (auto& interval : intervals) {
+    if (interval.start >= 0) order.push_back(&interval);
+  }
+  std::sort(order.begin(), order.end(), [](const Interval* a, const Interval* b) {
+    return a->start != b->start ? a->start < b->start : a->value < b->value;
+  });
+
+  const int caller_count = static_cast<int>(caller_saved_.size());
+  const int total = caller_count + static_cast<int>(callee_saved_.size());
+  std::vector<bool> busy(total, false);
+  std::vector<bool> saved(total, false);
+  std::vector<Interval*> active;   // 按结束点升序
+  std::vector<Interval*> spilled;
+
+  auto take_free = [&](int first, int last) {
+    for (int r = first; r < last; ++r) {
+      if (!busy[r]) return r;
+    }
+    return -1;
+  };
+  auto activate = [&](Interval* interval, int reg) {
+    interval->reg = reg;
+    busy[reg] = true;
+    if (reg >= caller_count) saved[reg] = true;
+    active.insert(std::upper_bound(active.begin(), active.end(), interval,
+                                   [](const Interval* a, const Interval* b) { return a->end < b->end; }),
+                  interval);
+  };
+
+  for (Interval* current : order) {
+    // 释放已经结束的区间
+    while (!active.empty() && active.front()->end < current->start) {
+      busy[active.front()->reg] = false;
+      active.erase(active.begin());
+    }
+
+    int reg = current->across_call ? -1 : take_free(0, caller_count);
+    if (reg < 0) reg = take_free(caller_count, total);
+    if (reg >= 0) {
+      activate(current, reg);
+      continue;
+    }
+
+    // 没有空闲寄存器：在寄存器类别合适的活跃区间中找结束最晚的
+    Interval* victim = nullptr;
+    for (Interval* interval : active) {
+      if (current->across_call && interval->reg < caller_count) continue;
+      if (!victim || interval->end >= victim->end) victim = interval;
+    }
+    if (victim && victim->end > current->end) {
+      reg = victim->reg;
+      active.erase(std::find(active.begin(), active.end(), victim));
+      victim->reg = -1;
+      spilled.push_back(victim);
+      activate(current, reg);
+    } else {
+      spilled.push_back(current);
+    }
+  }
+
+  RegisterAssignment assignment;
+  for (const auto& interval : intervals) {
+    if (interval.reg < 0) continue;
+    assignment.registers[liveness.name(interval.value)] =
+      interval.reg < caller_count ? caller_saved_[interval.reg] : callee_saved_[interval.reg - caller_count];
+  }
+  std::sort(spilled.begin(), spilled.end(), [](const Interval* a, const Interval* b) {
+    return a->start != b->start ? a->start < b->start : a->value < b->value;
+  });
+  for (const Interval* interval : spilled) {
+    assignment.spilled.push_back(liveness.name(interval->value));
+  }
+  for (int r = caller_count; r < total; ++r) {
+    if (saved[r]) assignment.saved_registers.push_back(callee_saved_[r - caller_count]);
+  }
+  return assignment;
+}
+
+GraphColoringAllocator::GraphColoringAllocator(std::vector<std::string> caller_saved, std::vector<std::string> callee_saved)
+  : caller_saved_(std::move(caller_saved)), callee_saved_(std::move(callee_saved)) {
+  if (caller_saved_.size() + callee_saved_.size() > 64) {
+    throw std::runtime_error("[RegisterAllocator] 寄存器池不能超过 64 个寄存器");
+  }
+}
+
+RegisterAssignment GraphColoringAllocator::allocate(const TacCode& code, const Liveness& liveness) const {
+  const int values = static_cast<int>(liveness.value_count());
+  const int caller_count = static_cast<int>(caller_saved_.size());
+  const int total = caller_count + static_cast<int>(callee_saved_.size());
+  // 颜色集合用位掩码表示，第 r 位是 caller_saved_ + callee_saved_ 中的第 r 个寄存器
+  const uint64_t all_colors = total == 64 ? ~uint64_t(0) : (uint64_t(1) << total) - 1;
+  const uint64_t callee_colors = all_colors & ~((uint64_t(1) << caller_count) - 1);
+  auto color_count = [](uint64_t colors) { return std::bitset<64>(colors).count(); };
+
+  std::vector<std::unordered_set<int>> adjacent(values);
+  auto add_edge = [&](int a, int b) {
+    if (a == b) return;
+    adjacent[a].insert(b);
+    adjacent[b].insert(a);
+  };
+  std::vector<uint64_t> allowed(values, all_colors);
+  std::vector<double> cost(values, 0);
+  struct Move {
+    int dst;
+    int src;
+  };
+  std::vector<Move> moves;
+
+  const size_t blocks = liveness.block_count();
+
+  // 冲突图：定值与其后活跃的值冲突；move 的目标不与源冲突，以便合并
+  for (size_t b = 0; b < blocks; ++b) {
+    const double weight = std::pow(10.0, std::min(liveness.cfg().loop_depth(b), 8));
+    liveness.walk_backward(b, [&](size_t i, const Liveness::LiveSet& live) {
+      const int def = liveness.def(i);
+      const auto& uses = liveness.uses(i);
+      const bool move = code[i].op == TacOp::ASSIGN && def >= 0 && uses.size() == 1;
+      if (move && uses[0] != def) moves.push_back({ def, uses[0] });
+      if (def >= 0) {
+        cost[def] += weight;
+        live.for_each([&](int v) {
+          if (!move || v != uses[0]) add_edge(def, v);
+        });
+      }
+      for (int use : uses) cost[use] += weight;
+      if (code[i].op != TacOp::CALL) return;
+      live.for_each([&](int v) {
+        if (v != def) allowed[v] &= callee_colors;
+      });
+    });
+  }
+  // 函数入口处活跃的值（参数）同时占用寄存器。入口处不活跃的参数不与它们冲突，
+  // 可能与别的参数同色，调用者只能在序言中装入 live_in(0) 中的参数（见 Code::table_to_allocated_mips）
+  if (blocks > 0) {
+    std::vector<int> entry;
+    liveness.live_in(0).for_each([&](int v) { entry.push_back(v); });
+    for (size_t i = 0; i < entry.size(); ++i) {
+      for (size_t j = i + 1; j < entry.size(); ++j) add_edge(entry[i], entry[j]);
+    }
+  }
+
+  // 合并：move 两端不冲突、可用颜色有交集，且合并后度数不小于自身颜色数的邻居少于交集的颜色数（Briggs）
+  std::vector<int> alias(values);
+  std::iota(alias.begin(), alias.end(), 0);
+  auto find = [&](int v) {
+    while (alias[v] != v) v = alias[v] = alias[alias[v]];
+    return v;
+  };
+  size_t coalesced = 0;
+  for (bool changed = true; changed;) {
+    changed = false;
+    for (const Move& move : moves) {
+      const int a = find(move.dst);
+      const int b = find(move.src);
+      if (a == b || adjacent[a].count(b)) continue;
+      const uint64_t colors = allowed[a] & allowed[b];
+      const size_t k = color_count(colors);
+      if (k == 0) continue;
+
+      size_t significant = 0;
+      std::unordered_set<int> neighbours(adjacent[a]);
+      neighbours.insert(adjacent[b].begin(), adjacent[b].end());
+      for (int n : neighbours) {
+        const size_t degree = adjacent[n].size() - (adjacent[a].count(n) && adjacent[b].count(n) ? 1 : 0);
+        if (degree >= color_count(allowed[n])) ++significant;
+      }
+      if (significant >= k) continue;
+
+      alias[b] = a;
+      allowed[a] = colors;
+      cost[a] += cost[b];
+      for (int n : adjacent[b]) {
+        adjacent[n].erase(b);
+        add_edge(a, n);
+      }
+      adjacent[b].clear();
+      ++coalesced;
+      changed = true;
+    }
+  }
+
+  // 化简：反复移去度数小于颜色数的结点；没有时按 代价 / 度数 最小选潜在溢出结点，同样压栈
+  std::vector<int> nodes;
+  for (int v = 0; v < values; ++v) {
+    if (find(v) == v) nodes.push_back(v);
+  }
+  std::vector<size_t> degree(values, 0);
+  std::vector<bool> removed(values, false);
+  std::vector<int> low;
+  for (int v : nodes) {
+    degree[v] = adjacent[v].size();
+    if (degree[v] < color_count(allowed[v])) low.push_back(v);
+  }
+  std::vector<int> stack;
+  auto remove = [&](int v) {
+    removed[v] = true;
+    stack.push_back(v);
+    for (int n : adjacent[v]) {
+      if (!removed[n] && degree[n]-- == color_count(allowed[n])) low.push_back(n);
+    }
+  };
+  while (stack.size() < nodes.size()) {
+    if (!low.empty()) {
+      const int v = low.back();
+      low.pop_back();
+      if (!removed[v]) remove(v);
+      continue;
+    }
+    int victim = -1;
+    double best = 0;
+    for (int v : nodes) {
+      if (removed[v]) continue;
+      const double score = cost[v] / std::max<size_t>(degree[v], 1);
+      if (victim < 0 || score < best) {
+        victim = v;
+        best = score;
+      }
+    }
+    remove(victim);
+  }
+
+  // 着色：出栈顺序依次选邻居没用过的颜色，优先与 move 的另一端同色，其次调用者保存的寄存器
+  std::vector<std::vector<int>> partners(values);
+  for (const Move& move : moves) {
+    const int a = find(move.dst);
+    const int b = find(move.src);
+    if (a == b) continue;
+    partners[a].push_back(b);
+    partners[b].push_back(a);
+  }
+  std::vector<int> color(values, -1);
+  for (auto it = stack.rbegin(); it != stack.rend(); ++it) {
+    const int v = *it;
+    uint64_t free = allowed[v];
+    for (int n : adjacent[v]) {
+      if (color[n] >= 0) free &= ~(uint64_t(1) << color[n]);
+    }
+    if (free == 0) continue;  // 实际溢出
+    for (int p : partners[v]) {
+      if (color[p] >= 0 && (free >> color[p] & 1)) {
+        color[v] = color[p];
+        break;
+      }
+    }
+    for (int r = 0; color[v] < 0; ++r) {
+      if (free >> r & 1) color[v] = r;
+    }
+  }
+
+  RegisterAssignment assignment;
+  assignment.coalesced = coalesced;
+  std::vector<bool> saved(total, false);
+  for (int v = 0; v < values; ++v) {
+    const int c = color[find(v)];
+    if (c < 0) {
+      assignment.spilled.push_back(liveness.name(v));
+      continue;
+    }
+    assignment.registers[liveness.name(v)] = c < caller_count ? caller_saved_[c] : callee_saved_[c - caller_count];
+    if (c >= caller_count) saved[c] = true;
+  }
+  for (int r = caller_count; r < total; ++r) {
+    if (saved[r]) assignment.saved_registers.push_back(callee_saved_[r - caller_count]);
+  }
+  return assignment;
+}
@@ -0,0 +1,134 @@
+#ifndef REGISTER_ALLOCATOR_HPP
+#define REGISTER_ALLOCATOR_HPP
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "cfg.hpp"
+#include "tac.hpp"
+
+// 一个函数的三地址代码上的活跃变量分析：在控制流图上按基本块迭代到不动点，块内需要时从块尾逐条回放。
+// 只分析 is_candidate 选出的操作数（寄存器候选：临时变量、本函数的标量变量），按首次出现编号
+class Liveness {
+public:
+  using Predicate = std::function<bool(const TacOperand&)>;
+
+  // 候选值的集合（位集）
+  class LiveSet {
+  public:
+    explicit LiveSet(size_t values = 0) : bits_((values + 63) / 64, 0) {}
+    bool contains(int value) const { return (bits_[value >> 6] >> (value & 63)) & 1; }
+    void insert(int value) { bits_[value >> 6] |= uint64_t(1) << (value & 63); }
+    void erase(int value) { bits_[value >> 6] &= ~(uint64_t(1) << (value & 63)); }
+
+    // 并入 other，返回是否有变化
+    bool merge(const LiveSet& other);
+
+    // 按编号升序访问每个元素
+    template <class Visitor>
+    void for_each(Visitor visit) const {
+      for (size_t w = 0; w < bits_.size(); ++w) {
+        for (uint64_t word = bits_[w], bit = 0; word; word >>= 1, ++bit) {
+          if (word & 1) visit(static_cast<int>(w * 64 + bit));
+        }
+      }
+    }
+
+  private:
+    std::vector<uint64_t> bits_;
+  };
+
+  Liveness(const TacCode& code, const Predicate& is_candidate);
+
+  // 指令条数
+  size_t size() const { return defs_.size(); }
+
+  // 候选值个数、编号与名字的对应
+  size_t value_count() const { return names_.size(); }
+  const std::string& name(int value) const { return names_[value]; }
+  int value(const std::string& name) const;
+
+  // 指令 i 定值的候选（-1 表示没有）和引用的候选
+  int def(size_t i) const { return defs_[i]; }
+  const std::vector<int>& uses(size_t i) const { return uses_[i]; }
+
+  // 控制流图，以及它的基本块 [begin, end) 与后继
+  const ControlFlowGraph& cfg() const { return cfg_; }
+  size_t block_count() const { return cfg_.size(); }
+  size_t block_begin(size_t block) const { return cfg_.block(block).begin; }
+  size_t block_end(size_t block) const { return cfg_.block(block).end; }
+  const std::vector<size_t>& successors(size_t block) const { return cfg_.block(block).successors; }
+
+  // 块入口 / 出口处活跃的候选
+  const LiveSet& live_in(size_t block) const { return live_in_[block]; }
+  const LiveSet& live_out(size_t block) const { return live_out_[block]; }
+
+  // 从块尾向块首逐条访问：visit(i, live)，live 为指令 i 执行之后活跃的候选
+  template <class Visitor>
+  void walk_backward(size_t block, Visitor visit) const {
+    LiveSet live = live_out_[block];
+    for (size_t i = block_end(block); i-- > block_begin(block);) {
+      visit(i, static_cast<const LiveSet&>(live));
+      if (defs_[i] >= 0) live.erase(defs_[i]);
+      for (int use : uses_[i]) live.insert(use);
+    }
+  }
+
+private:
+  std::vector<std::string> names_;
+  std::unordered_map<std::string, int> values_;
+  std::vector<int> defs_;
+  std::vector<std::vector<int>> uses_;
+  ControlFlowGraph cfg_;
+  std::vector<LiveSet> live_in_;
+  std::vector<LiveSet> live_out_;
+};
+
+// 寄存器分配结果：候选值要么分到物理寄存器，要么溢出到内存
+struct RegisterAssignment {
+  std::unordered_map<std::string, std::string> registers;  // 名字 -> 物理寄存器，如 "$s0"
+  std::vector<std::string> spilled;                         // 溢出的名字，按区间起点 / 首次出现排序
+  std::vector<std::string> saved_registers;                 // 用到的被调用者保存寄存器，按池中顺序
+  size_t coalesced = 0;                                     // 合并的 move 条数（图着色）
+};
+
+// 线性扫描寄存器分配（Poletto & Sarkar）：活跃区间按起点排序依次分配，
+// 没有空闲寄存器时溢出结束最晚的区间。跨过 CALL 的区间只能用被调用者保存的寄存器
+class LinearScanAllocator {
+public:
+  // 默认寄存器池：调用者保存的 $t0-$t9，被调用者保存的 $s0-$s7
+  static const std::vector<std::string> CALLER_SAVED;
+  static const std::vector<std::string> CALLEE_SAVED;
+
+  explicit LinearScanAllocator(std::vector<std::string> caller_saved = CALLER_SAVED,
+                               std::vector<std::string> callee_saved = CALLEE_SAVED);
+
+  // liveness 必须由同一段 code 计算
+  RegisterAssignment allocate(const TacCode& code, const Liveness& liveness) const;
+
+private:
+  std::vector<std::string> caller_saved_;
+  std::vector<std::string> callee_saved_;
+};
+
+// 图着色寄存器分配（Chaitin–Briggs）：由活跃信息建冲突图，按 Briggs 保守准则合并 move 的两端，
+// 化简时没有度数小于可用寄存器数的结点就按 溢出代价 / 度数 最小选出潜在溢出结点，
+// 着色时乐观地为它再找一次颜色。溢出代价是定值和引用次数按自然循环的嵌套深度加权（每层 ×10）。
+// 跨过 CALL 的结点只能着被调用者保存的颜色
+class GraphColoringAllocator {
+public:
+  explicit GraphColoringAllocator(std::vector<std::string> caller_saved = LinearScanAllocator::CALLER_SAVED,
+                                  std::vector<std::string> callee_saved = LinearScanAllocator::CALLEE_SAVED);
+
+  // liveness 必须由同一段 code 计算
+  RegisterAssignment allocate(const TacCode& code, const Liveness& liveness) const;
+
+private:
+  std::vector<std::string> caller_saved_;
+  std::vector<std::string> callee_saved_;
+};
+
+#endif // REGISTER_ALLOCATOR_HPP
@@ -1,8 +1,17 @@
 #include "slr_table.hpp"
+#include "mapped_file.hpp"
 #include "utils/csv.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <set>
 #include "utils/strtool.hpp"
 
+#ifdef SLR_TABLE_GENERATED_HEADER
+#include SLR_TABLE_GENERATED_HEADER
+#endif
+
 SLRTable::SLRTable(const std::string &content) {
   if (content.find(',') != content.npos && content.find("State") != content.npos) {
     parse_file(content);
@@ -17,6 +26,12 @@ SLRTable::SLRTable(const ItemCluster& cluster): item_cluster_(cluster) {
 }
 
 const SLRTable::ActionSet* SLRTable::get_action(int state, const std::string& symbol) const {
+  return get_action(state, symbols_->find(symbol));
+}
+
+const SLRTable::ActionSet* SLRTable::get_action(int state, SymbolId symbol) const {
+  if (symbol == NO_SYMBOL) return nullptr;
+  restore_tables();
   auto it1 = action_table_.find(state);
   if (it1 == action_table_.end()) return nullptr;
   auto it2 = it1->second.find(symbol);
@@ -25,18 +40,33 @@ const SLRTable::ActionSet* SLRTable::get_action(int state, const std::string& sy
 }
 
 SLRTable::ActionRow SLRTable::get_action(int state) const {
+  restore_tables();
+  ActionRow row;
   auto it = action_table_.find(state);
   if (it != action_table_.end()) {
-    return it->second;
+    for (const auto& [symbol, actions] : it->second) {
+      row[symbols_->name(symbol)] = actions;
+    }
   }
-  return {};
+  return row;
 }
 
 std::unordered_map<int, SLRTable::ActionRow> SLRTable::get_action() const {
-  return action_table_;
+  restore_tables();
+  std::unordered_map<int, ActionRow> table;
+  for (const auto& [state, _] : action_table_) {
+    table[state] = get_action(state);
+  }
+  return table;
 }
 
 const SLRTable::GotoSet* SLRTable::get_goto(int state, const std::string& non_terminal) const {
+  return get_goto(state, symbols_->find(non_terminal));
+}
+
+const SLRTable::GotoSet* SLRTable::get_goto(int state, SymbolId non_terminal) const {
+  if (non_terminal == NO_SYMBOL) return nullptr;
+  restore_tables();
   auto it1 = goto_table_.find(state);
   if (it1 == goto_table_.end()) return nullptr;
   auto it2 = it1->second.find(non_terminal);
@@ -45,45 +75,80 @@ const SLRTable::GotoSet* SLRTable::get_goto(int state, const std::string& non_te
 }
 
 SLRTable::GotoRow SLRTable::get_goto(int state) const {
+  restore_tables();
+  GotoRow row;
   auto it = goto_table_.find(state);
   if (it != goto_table_.end()) {
-    return it->second;
+    for (const auto& [symbol, targets] : it->second) {
+      row[symbols_->name(symbol)] = targets;
+    }
   }
-  return {};
+  return row;
 }
 
 std::unordered_map<int, SLRTable::GotoRow> SLRTable::get_goto() const {
-  return goto_table_;
+  restore_tables();
+  std::unordered_map<int, GotoRow> table;
+  for (const auto& [state, _] : goto_table_) {
+    table[state] = get_goto(state);
+  }
+  return table;
+}
+
+SLRTable::ActionIdRow& SLRTable::action_row(const int state) const {
+  restore_tables();
+  auto it = action_table_.find(state);
+  if (it == action_table_.end()) {
+    it = action_table_.emplace(state, ActionIdRow(0, SymbolNameHash{symbols_.get()})).first;
+  }
+  return it->second;
+}
+
+SLRTable::GotoIdRow& SLRTable::goto_row(const int state) const {
+  restore_tables();
+  auto it = goto_table_.find(state);
+  if (it == goto_table_.end()) {
+    it = goto_table_.emplace(state, GotoIdRow(0, SymbolNameHash{symbols_.get()})).first;
+  }
+  return it->second;
 }
 
 void SLRTable::add_action(const int state, const std::string& symbol, const ActionType type, const int target) {
+  add_action(state, symbols_->intern(symbol), type, target);
+}
+
+void SLRTable::add_action(const int state, const SymbolId symbol, const ActionType type, const int target) {
   Action new_action{type, target};
-  action_table_[state][symbol].insert(new_action);
+  action_row(state)[symbol].insert(new_action);
 }
 
 void SLRTable::add_goto(const int state, const std::string& non_terminal, const int next_state) {
-  goto_table_[state][non_terminal].insert(next_state);
+  add_goto(state, symbols_->intern(non_terminal), next_state);
+}
+
+void SLRTable::add_goto(const int state, const SymbolId non_terminal, const int next_state) {
+  goto_row(state)[non_terminal].insert(next_state);
 }
 
 void SLRTable::set_action(const int state, const std::string &symbol, const ActionType type, const int target) {
   Action new_action{type, target};
-  action_table_[state][symbol] = {new_action};
+  action_row(state)[symbols_->intern(symbol)] = {new_action};
 }
 
 void SLRTable::set_action(const int state, const std::string &symbol, const Action &action) {
-  action_table_[state][symbol] = {action};
+  action_row(state)[symbols_->intern(symbol)] = {action};
 }
 
 void SLRTable::set_action(const int state, const std::string &symbol, const ActionSet &actions) {
-  action_table_[state][symbol] = actions;
+  action_row(state)[symbols_->intern(symbol)] = actions;
 }
 
 void SLRTable::set_goto(const int state, const std::string &non_terminal, const int next_state) {
-  goto_table_[state][non_terminal] = {next_state};
+  goto_row(state)[symbols_->intern(non_terminal)] = {next_state};
 }
 
 void SLRTable::set_goto(const int state, const std::string &non_terminal, const GotoSet &next_states) {
-  goto_table_[state][non_terminal] = next_states;
+  goto_row(state)[symbols_->intern(non_terminal)] = next_states;
 }
 
 int SLRTable::start_state() const {
@@ -99,32 +164,39 @@ int SLRTable::final_accept_state() const {
 }
 
 const SLRTable::ConflictSet& SLRTable::conflicts() const {
+  restore_tables();
   return conflicts_;
 }
 
 const std::unordered_map<std::string, int>& SLRTable::state_to_id() const {
+  restore_tables();
   return state_to_id_;
 }
 
 const std::unordered_map<Grammar, int, Grammar::Hash>& SLRTable::grammar_to_id() const {
+  restore_productions();
   return grammar_to_id_;
 }
 
 const std::unordered_map<int, std::string> SLRTable::id_to_state() const {
+  restore_tables();
   return id_to_state_;
 }
 
 const std::unordered_map<int, Grammar> SLRTable::id_to_grammar() const {
+  restore_productions();
   return id_to_grammar_;
 }
 
 std::string SLRTable::find_state(const int id) const {
+  restore_tables();
   auto it = id_to_state_.find(id);
   if (it != id_to_state_.end()) return it->second;
   throw std::out_of_range("State ID not found.");
 }
 
 int SLRTable::find_state(const std::string& name) const {
+  restore_tables();
   auto it = state_to_id_.find(name);
   if (it != state_to_id_.end()) return it->second;
   throw std::out_of_range("State name not found.");
@@ -136,6 +208,7 @@ ItemCluster::State SLRTable::find_item_set(const int id) const {
 }
 
 Grammar SLRTable::find_grammar(const int id) const {
+  restore_productions();
   return id_to_grammar_.at(id);
 }
 
@@ -161,14 +234,144 @@ std::ostream& operator<<(std::ostream& os, const SLRTable::Action& action) {
 }
 
 int SLRTable::find_grammar(const Grammar &grammar) const {
+  restore_productions();
   return grammar_to_id_.at(grammar);
 }
 
+size_t SLRTable::production_count() const {
+  if (productions_pending_) return image_.production_count;
+  int max_id = -1;
+  for (const auto& [id, _] : id_to_grammar_) max_id = std::max(max_id, id);
+  return static_cast<size_t>(max_id + 1);
+}
+
+SymbolId SLRTable::production_lhs(const int id) const {
+  if (productions_pending_) {
+    return id < 0 || static_cast<uint32_t>(id) >= image_.production_count
+           ? NO_SYMBOL : image_.productions[image_.production_offsets[id]];
+  }
+  auto it = id_to_grammar_.find(id);
+  if (it == id_to_grammar_.end()) return NO_SYMBOL;
+  return it->second.bound() ? it->second.lhs_id() : symbols_->find(it->second.lhs());
+}
+
+int SLRTable::production_length(const int id) const {
+  if (productions_pending_) {
+    if (id < 0 || static_cast<uint32_t>(id) >= image_.production_count) return -1;
+    const int32_t* begin = image_.productions + image_.production_offsets[id];
+    const int32_t* end = image_.productions + image_.production_offsets[id + 1];
+    // 右部只有一个 ε 的产生式归约时不弹栈
+    return end - begin == 2 && begin[1] == SymbolInterner::EPSILON ? 0 : static_cast<int>(end - begin - 1);
+  }
+  auto it = id_to_grammar_.find(id);
+  if (it == id_to_grammar_.end()) return -1;
+  return it->second.is_epsilon() ? 0 : static_cast<int>(it->second.rhs().size());
+}
+
 void SLRTable::build() {
   build(item_cluster_); // 直接调用有参版
 }
 
+ParseTable::Entry SLRTable::pack(const Action& action) {
+  switch (action.type) {
+    case SHIFT:  return ParseTable::pack(ParseTable::SHIFT, action.target);
+    case REDUCE: return ParseTable::pack(ParseTable::REDUCE, action.target);
+    case ACCEPT: return ParseTable::pack(ParseTable::ACCEPT, 0);
+    default:     return 0;
+  }
+}
+
+SLRTable::Action SLRTable::unpack(const ParseTable::Entry entry) {
+  switch (ParseTable::kind(entry)) {
+    case ParseTable::SHIFT:  return {SHIFT, static_cast<int>(ParseTable::target(entry))};
+    case ParseTable::REDUCE: return {REDUCE, static_cast<int>(ParseTable::target(entry))};
+    case ParseTable::ACCEPT: return {ACCEPT, -1};
+    default:                 return {ERROR, -1};
+  }
+}
+
+void SLRTable::compile() {
+  restore_tables();
+  // 收集状态数与各列符号（按 id 升序）
+  int max_state = -1;
+  std::set<SymbolId> terminal_set = {SymbolInterner::END};
+  std::set<SymbolId> non_terminal_set;
+  for (const auto& [state, row] : action_table_) {
+    max_state = std::max(max_state, state);
+    for (const auto& [symbol, _] : row) terminal_set.insert(symbol);
+  }
+  for (const auto& [state, row] : goto_table_) {
+    max_state = std::max(max_state, state);
+    for (const auto& [symbol, _] : row) non_terminal_set.insert(symbol);
+  }
+
+  compiled_ = ParseTable(max_state + 1,
+                         std::vector<SymbolId>(terminal_set.begin(), terminal_set.end()),
+                         std::vector<SymbolId>(non_terminal_set.begin(), non_terminal_set.end()));
+
+  for (const auto& [state, row] : action_table_) {
+    for (const auto& [symbol, actions] : row) {
+      if (actions.size() == 1) {
+        compiled_.set_action(state, symbol, pack(*actions.begin()));
+      } else if (actions.size() > 1) {
+        std::vector<ParseTable::Entry> entries;
+        for (const auto& action : actions) entries.push_back(pack(action));
+        compiled_.add_conflict(state, symbol, entries);
+      }
+    }
+  }
+
+  for (const auto& [state, row] : goto_table_) {
+    for (const auto& [symbol, targets] : row) {
+      if (!targets.empty()) {
+        compiled_.set_goto(state, symbol, *targets.begin());
+      }
+    }
+  }
+}
+
+// unordered 容器的估算：桶数组 + 每个节点（next 指针 + 值 + 缓存的哈希）
+template <typename Map>
+static size_t unordered_bytes(const Map& map) {
+  return sizeof(Map) + map.bucket_count() * sizeof(void*) +
+         map.size() * (sizeof(void*) + sizeof(typename Map::value_type) + sizeof(size_t));
+}
+
+size_t SLRTable::map_bytes() const {
+  restore_tables();
+  size_t total = unordered_bytes(action_table_) + unordered_bytes(goto_table_);
+  for (const auto& [_, row] : action_table_) {
+    total += unordered_bytes(row) - sizeof(row);
+    for (const auto& [_, actions] : row) total += unordered_bytes(actions) - sizeof(actions);
+  }
+  for (const auto& [_, row] : goto_table_) {
+    total += unordered_bytes(row) - sizeof(row);
+    for (const auto& [_, targets] : row) total += unordered_bytes(targets) - sizeof(targets);
+  }
+  return total;
+}
+
+void SLRTable::table_bytes_to_txt(const std::string &filename) const {
+  std::ofstream out(filename);
+  if (!out) {
+    std::cerr << "[SLR] 无法打开文件 " << filename << std::endl;
+    return;
+  }
+  const CompressedParseTable exact = compress(true);
+  const CompressedParseTable yacc = compress(false);
+  out << "状态数: " << compiled_.state_count()
+      << "    终结符数: " << compiled_.terminals().size()
+      << "    非终结符数: " << compiled_.non_terminals().size() << "\n";
+  out << "map:              " << map_bytes() << " 字节\n";
+  out << "dense:            " << compiled_.bytes() << " 字节\n";
+  out << "compressed:       " << exact.bytes() << " 字节 (ACTION " << exact.action_entries()
+      << " 格, GOTO " << exact.goto_entries() << " 格)\n";
+  out << "compressed(yacc): " << yacc.bytes() << " 字节 (ACTION " << yacc.action_entries()
+      << " 格, GOTO " << yacc.goto_entries() << " 格)\n";
+}
+
 int SLRTable::compute_conflict() {
+  restore_tables();
   int conflict_state_count = 0;
   // 检查ACTION表冲突
   for (const auto& [state, action_row] : action_table_) {
@@ -177,7 +380,7 @@ int SLRTable::compute_conflict() {
       if (actions.size() > 1) {
         Conflict conflict;
         conflict.state = state;
-        conflict.symbol = symbol;
+        conflict.symbol = symbols_->name(symbol);
         conflict.actions = actions;
         conflict.type = detect_conflict_type(actions);
         conflicts_.insert(conflict);
@@ -198,9 +401,13 @@ int SLRTable::compute_conflict() {
 }
 
 void SLRTable::parse_stream(const std::string &content) {
+  // 装入的表：先还原状态名和产生式，它们在读入 CSV 后保留
+  restore_tables();
+  restore_productions();
   action_table_.clear();
   goto_table_.clear();
   conflicts_.clear();
+  compiled_ = ParseTable();
   Csv csv;
   GrammarSet grammar_set = item_cluster_.grammar_set();
   grammar_set.compute_symbols();
@@ -275,18 +482,29 @@ void SLRTable::parse_stream(const std::string &content) {
       if (actions.size() > 1) {
         Conflict conflict;
         conflict.state = state;
-        conflict.symbol = symbol;
+        conflict.symbol = symbols_->name(symbol);
         conflict.actions = actions;
         conflict.type = detect_conflict_type(actions);
         conflicts_.insert(conflict);
       }
     }
   }
+
+  compile();
 }
 
 void SLRTable::build(const ItemCluster& cluster) {
   item_cluster_ = cluster;
+  symbols_ = item_cluster_.grammar_set().symbols_ptr();
+
+  // LR(1) 模式：在同一文法集上重新构建自动机
+  std::unique_ptr<LR1Automaton> lr1;
+  if (method_ == LR1 || method_ == PAGER) {
+    lr1 = std::make_unique<LR1Automaton>(item_cluster_.grammar_set(), method_ == PAGER);
+    item_cluster_ = lr1->cluster();
+  }
 
+  drop_image();
   action_table_.clear();
   goto_table_.clear();
   conflicts_.clear();
@@ -299,10 +517,17 @@ void SLRTable::build(const ItemCluster& cluster) {
   GrammarSet grammar_set = item_cluster_.grammar_set();
   grammar_set.compute_first();
   grammar_set.compute_follow();
+  grammar_checksum_ = grammar_set.source_checksum();
 
   assign_ids(item_cluster_);
   compute_states(item_cluster_);
 
+  // LALR 模式：在 LR(0) 自动机上计算每个归约项目的向前看符号
+  std::unique_ptr<LALRLookahead> lalr;
+  if (method_ == LALR) {
+    lalr = std::make_unique<LALRLookahead>(item_cluster_);
+  }
+
   int shift_count = 0;
   int reduce_count = 0;
   int accept_count = 0;
@@ -343,6 +568,14 @@ void SLRTable::build(const ItemCluster& cluster) {
           add_action(state_id, "#", ACCEPT, -1);
           accept_count++;
           has_accept = true;
+        } else if (lalr || lr1) {
+          const auto& lookahead = lalr ? lalr->lookahead(state_name, item.production())
+                                       : lr1->lookahead(state_name, item.production());
+          for (SymbolId a : lookahead) {
+            add_action(state_id, a, REDUCE, prod_id);
+            reduce_count++;
+            has_reduce = true;
+          }
         } else {
           const auto& follow = grammar_set.follow_set().at(item.lhs());
           for (const auto& a : follow) {
@@ -352,26 +585,21 @@ void SLRTable::build(const ItemCluster& cluster) {
           }
         }
       } else {
-        const auto& rhs = item.rhs();
-        for (size_t i = 0; i < rhs.size(); ++i) {
-          if (!rhs[i].empty() && rhs[i][0] == '`') {
-            if (i + 1 < rhs.size()) {
-              const std::string& next_sym = rhs[i + 1];
-              if (grammar_set.terminals().count(next_sym)) {
-                if (state.goto_table.count(next_sym)) {
-                  const std::string& target_name = state.goto_table.at(next_sym);
-                  if (state_to_id_.count(target_name)) {
-                    int target_id = state_to_id_.at(target_name);
-                    add_action(state_id, next_sym, SHIFT, target_id);
-                    shift_count++;
-                    has_shift = true;
-                  } else {
-                    std::cerr << "[Warning] GOTO目标状态 " << target_name << " 不存在\n";
-                  }
-                }
+        SymbolId next_id = item.next_symbol_id();
+        if (next_id != NO_SYMBOL) {
+          const std::string& next_sym = symbols_->name(next_id);
+          if (grammar_set.terminals().count(next_sym)) {
+            if (state.goto_table.count(next_sym)) {
+              const std::string& target_name = state.goto_table.at(next_sym);
+              if (state_to_id_.count(target_name)) {
+                int target_id = state_to_id_.at(target_name);
+                add_action(state_id, next_id, SHIFT, target_id);
+                shift_count++;
+                has_shift = true;
+              } else {
+                std::cerr << "[Warning] GOTO目标状态 " << target_name << " 不存在\n";
               }
             }
-            break;
           }
         }
       }
@@ -382,16 +610,87 @@ void SLRTable::build(const ItemCluster& cluster) {
     if (has_accept) accept_state_count++;
   }
 
+  auto [resolved_count, kept_count] = resolve_precedence(grammar_set);
   conflict_state_count = compute_conflict();
+  compile();
 
-  std::cout << "\n------ SLR表构建完成 ------\n";
+  static const char* const method_names[] = {"SLR", "LALR(1)", "LR(1)", "LR(1)(Pager合并)"};
+  std::cout << "\n------ " << method_names[method_] << "表构建完成 ------\n";
   std::cout << "移进状态数: " << shift_state_count << "    移进动作数: " << shift_count << "\n";
   std::cout << "归约状态数: " << reduce_state_count << "    归约动作数: " << reduce_count << "\n";
   std::cout << "接受状态数: " << accept_state_count << "    接受动作数: " << accept_count << "\n";
+  if (!grammar_set.precedences().empty()) {
+    std::cout << "优先级消解: " << resolved_count << "    保留冲突: " << kept_count << "\n";
+  }
   std::cout << "冲突状态数: " << conflict_state_count << "    冲突动作数: " << conflicts_.size() << "\n";
   std::cout << "总状态数 (STATES): " << item_cluster_.states().size() << "\n\n";
 }
 
+std::pair<int, int> SLRTable::resolve_precedence(const GrammarSet& grammar_set) {
+  int resolved_count = 0;
+  int kept_count = 0;
+  if (grammar_set.precedences().empty()) {
+    return {resolved_count, kept_count};
+  }
+
+  const auto& precedences = grammar_set.precedences();
+  for (auto& [state, row] : action_table_) {
+    for (auto it = row.begin(); it != row.end();) {
+      ActionSet& actions = it->second;
+      if (actions.size() < 2) {
+        ++it;
+        continue;
+      }
+
+      const Action* shift = nullptr;
+      const Action* reduce = nullptr;
+      int reduce_count = 0;
+      for (const auto& action : actions) {
+        if (action.type == SHIFT) shift = &action;
+        if (action.type == REDUCE) {
+          reduce = &action;
+          reduce_count++;
+        }
+      }
+      auto token = precedences.find(symbols_->name(it->first));
+      const GrammarSet::Precedence* rule =
+          reduce == nullptr ? nullptr : grammar_set.precedence(id_to_grammar_.at(reduce->target));
+
+      // 只消解一个移进对一个归约、且双方都有声明的格子；
+      // 归约-归约冲突和未声明的格子与 yacc 一样保留为冲突，留给 eliminate_conflict() 处理
+      if (shift == nullptr || reduce_count != 1 || token == precedences.end() || rule == nullptr) {
+        kept_count++;
+        std::cerr << "[SLR] 状态 " << state << " 符号 " << symbols_->name(it->first)
+                  << (reduce_count > 1 ? " 有多个归约" : " 未声明优先级") << "，保留冲突:";
+        for (const auto& action : actions) {
+          std::cerr << " " << action;
+        }
+        std::cerr << "\n";
+        ++it;
+        continue;
+      }
+
+      resolved_count++;
+      ActionSet result;
+      if (token->second.level > rule->level ||
+          (token->second.level == rule->level && token->second.associativity == GrammarSet::RIGHT)) {
+        result.insert(*shift);
+      } else if (token->second.level < rule->level || token->second.associativity == GrammarSet::LEFT) {
+        result.insert(*reduce);
+      }
+      // 同级不可结合：两者都去掉，出错
+
+      if (result.empty()) {
+        it = row.erase(it);
+      } else {
+        actions = std::move(result);
+        ++it;
+      }
+    }
+  }
+  return {resolved_count, kept_count};
+}
+
 SLRTable::ConflictType SLRTable::detect_conflict_type(const SLRTable::ActionSet& actions) {
   bool has_shift = false, has_reduce = false;
   for (const auto& act : actions) {
@@ -406,6 +705,7 @@ SLRTable::ConflictType SLRTable::detect_conflict_type(const SLRTable::ActionSet&
 }
 
 void SLRTable::to_csv(const std::string &filename) const {
+  restore_tables();
   Csv csv;
 
   GrammarSet grammar_set = item_cluster_.grammar_set();
@@ -415,12 +715,12 @@ void SLRTable::to_csv(const std::string &filename) const {
   std::unordered_set<std::string> symbols;
   for (const auto& [_, action_row] : action_table_) {
     for (const auto& [symbol, _] : action_row) {
-      symbols.insert(symbol);
+      symbols.insert(symbols_->name(symbol));
     }
   }
   for (const auto& [_, goto_row] : goto_table_) {
     for (const auto& [symbol, _] : goto_row) {
-      symbols.insert(symbol);
+      symbols.insert(symbols_->name(symbol));
     }
   }
   symbols.insert("#"); // 强制把 # 加入
@@ -463,7 +763,7 @@ void SLRTable::to_csv(const std::string &filename) const {
       std::string cell;
 
       if (auto act_it = action_table_.find(state); act_it != action_table_.end()) {
-        if (auto sym_it = act_it->second.find(sym); sym_it != act_it->second.end()) {
+        if (auto sym_it = act_it->second.find(symbols_->find(sym)); sym_it != act_it->second.end()) {
           const ActionSet& actions = sym_it->second;
 
           size_t cnt = 0;
@@ -488,7 +788,7 @@ void SLRTable::to_csv(const std::string &filename) const {
       std::string cell;
 
       if (auto goto_it = goto_table_.find(state); goto_it != goto_table_.end()) {
-        if (auto sym_it = goto_it->second.find(sym); sym_it != goto_it->second.end()) {
+        if (auto sym_it = goto_it->second.find(symbols_->find(sym)); sym_it != goto_it->second.end()) {
           const GotoSet& gotos = sym_it->second;
 
           if (!gotos.empty()) {
@@ -507,6 +807,7 @@ void SLRTable::to_csv(const std::string &filename) const {
 }
 
 void SLRTable::conflict_to_txt(const std::string &filename) const {
+  restore_tables();
   std::ofstream out(filename);
   if (!out) {
     std::cerr << "[SLR] 无法打开文件 " << filename << std::endl;
@@ -527,6 +828,7 @@ void SLRTable::conflict_to_txt(const std::string &filename) const {
 }
 
 void SLRTable::conflict_to_csv(const std::string &filename) const {
+  restore_tables();
   Csv csv;
 
   // 添加表头，包括新列 "修正"
@@ -613,10 +915,16 @@ void SLRTable::eliminate_conflict(const std::string &filename) {
     int state = strtool::extract_kth_number(item_set, 1);  // 从 Item Set 提取状态
     set_action(state, conflict_symbol, action.type, action.target);
   }
+
+  // 修正后重新统计剩余的冲突
+  conflicts_.clear();
+  compute_conflict();
+  compile();
 }
 
 
 void SLRTable::id_to_grammar_to_txt(const std::string &filename) const {
+  restore_productions();
   std::ofstream out(filename);
   if (!out) {
     std::cerr << "[SLR] 无法打开文件 " << filename << std::endl;
@@ -660,6 +968,551 @@ void SLRTable::read_csv(const std::string& file) {
   parse_file(file);
 }
 
+// 二进制分析表的文件头，之后依次为 Image 中各数组（均按 4 字节对齐）：
+//   名字偏移、名字字节、产生式偏移、产生式、ACTION 列符号、GOTO 列符号、ACTION、GOTO、接受状态、冲突偏移、冲突
+struct BinaryHeader {
+  char magic[4];
+  uint32_t version;
+  uint64_t grammar_checksum;
+  uint32_t file_size;
+  uint32_t method;
+  uint32_t symbol_count;
+  uint32_t production_count;
+  uint32_t state_count;
+  uint32_t terminal_count;
+  uint32_t non_terminal_count;
+  uint32_t accept_count;
+  uint32_t conflict_count;
+  int32_t start_state;
+  int32_t final_accept_state;
+  uint32_t name_bytes;
+  uint32_t production_words;
+  uint32_t conflict_words;
+};
+
+static constexpr char BINARY_MAGIC[4] = {'S', 'L', 'R', 'B'};
+
+// Image 中不能直接指向 compiled_ 的数组
+struct SLRTable::ImageBuffers {
+  std::vector<uint32_t> name_offsets = {0};
+  std::string names;
+  std::vector<uint32_t> production_offsets = {0};
+  std::vector<int32_t> productions;
+  std::vector<int32_t> accept_states;
+  std::vector<uint32_t> conflict_offsets = {0};
+  std::vector<uint32_t> conflicts;
+};
+
+SLRTable::Image SLRTable::image(ImageBuffers& buffers) const {
+  restore_tables();
+  restore_productions();
+  Image image{};
+  image.grammar_checksum = grammar_checksum_;
+  image.method = method_;
+  image.symbol_count = static_cast<uint32_t>(symbols_->size());
+  image.production_count = static_cast<uint32_t>(id_to_grammar_.size());
+  image.state_count = static_cast<uint32_t>(compiled_.state_count());
+  image.terminal_count = static_cast<uint32_t>(compiled_.terminals().size());
+  image.non_terminal_count = static_cast<uint32_t>(compiled_.non_terminals().size());
+  image.accept_count = static_cast<uint32_t>(accept_states_.size());
+  image.conflict_count = static_cast<uint32_t>(compiled_.conflicts().size());
+  image.start_state = start_state_;
+  image.final_accept_state = final_accept_state_;
+
+  // 名字：符号按 id，状态按编号
+  for (SymbolId id = 0; id < static_cast<SymbolId>(symbols_->size()); ++id) {
+    buffers.names += symbols_->name(id);
+    buffers.name_offsets.push_back(static_cast<uint32_t>(buffers.names.size()));
+  }
+  for (uint32_t state = 0; state < image.state_count; ++state) {
+    auto it = id_to_state_.find(static_cast<int>(state));
+    buffers.names += it == id_to_state_.end() ? "" : it->second;
+    buffers.name_offsets.push_back(static_cast<uint32_t>(buffers.names.size()));
+  }
+
+  // 产生式按编号
+  for (uint32_t id = 0; id < image.production_count; ++id) {
+    const Grammar& grammar = id_to_grammar_.at(static_cast<int>(id));
+    buffers.productions.push_back(grammar.lhs_id());
+    buffers.productions.insert(buffers.productions.end(), grammar.rhs_ids().begin(), grammar.rhs_ids().end());
+    buffers.production_offsets.push_back(static_cast<uint32_t>(buffers.productions.size()));
+  }
+
+  buffers.accept_states.assign(accept_states_.begin(), accept_states_.end());
+  std::sort(buffers.accept_states.begin(), buffers.accept_states.end());
+
+  for (const auto& conflict : compiled_.conflicts()) {
+    buffers.conflicts.push_back(static_cast<uint32_t>(conflict.state));
+    buffers.conflicts.push_back(static_cast<uint32_t>(conflict.symbol));
+    buffers.conflicts.insert(buffers.conflicts.end(), conflict.actions.begin(), conflict.actions.end());
+    buffers.conflict_offsets.push_back(static_cast<uint32_t>(buffers.conflicts.size()));
+  }
+
+  image.name_offsets = buffers.name_offsets.data();
+  image.names = buffers.names.data();
+  image.production_offsets = buffers.production_offsets.data();
+  image.productions = buffers.productions.data();
+  image.terminals = compiled_.terminals().data();
+  image.non_terminals = compiled_.non_terminals().data();
+  image.actions = compiled_.actions().data();
+  image.gotos = compiled_.gotos().data();
+  image.accept_states = buffers.accept_states.data();
+  image.conflict_offsets = buffers.conflict_offsets.data();
+  image.conflicts = buffers.conflicts.data();
+  return image;
+}
+
+// 按段追加到字节缓冲
+class BinaryWriter {
+public:
+  template <typename T>
+  void put(const T* data, size_t count) {
+    const char* bytes = reinterpret_cast<const char*>(data);
+    buffer_.insert(buffer_.end(), bytes, bytes + count * sizeof(T));
+    buffer_.resize((buffer_.size() + 3) / 4 * 4, 0);
+  }
+
+  std::vector<char>& buffer() { return buffer_; }
+
+private:
+  std::vector<char> buffer_;
+};
+
+// 在映射的内存上按段取出数组，越界时返回 nullptr
+class BinaryReader {
+public:
+  BinaryReader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+  template <typename T>
+  const T* take(size_t count) {
+    if (count > size_ / sizeof(T)) return nullptr;
+    const size_t bytes = (count * sizeof(T) + 3) / 4 * 4;
+    if (bytes > size_ - offset_) return nullptr;
+    const T* result = reinterpret_cast<const T*>(data_ + offset_);
+    offset_ += bytes;
+    return result;
+  }
+
+  size_t offset() const { return offset_; }
+
+private:
+  const uint8_t* data_;
+  size_t size_;
+  size_t offset_ = 0;
+};
+
+void SLRTable::to_binary(const std::string& filename) const {
+  ImageBuffers buffers;
+  const Image image = this->image(buffers);
+
+  BinaryHeader header{};
+  std::memcpy(header.magic, BINARY_MAGIC, sizeof(header.magic));
+  header.version = BINARY_VERSION;
+  header.grammar_checksum = image.grammar_checksum;
+  header.method = image.method;
+  header.symbol_count = image.symbol_count;
+  header.production_count = image.production_count;
+  header.state_count = image.state_count;
+  header.terminal_count = image.terminal_count;
+  header.non_terminal_count = image.non_terminal_count;
+  header.accept_count = image.accept_count;
+  header.conflict_count = image.conflict_count;
+  header.start_state = image.start_state;
+  header.final_accept_state = image.final_accept_state;
+  header.name_bytes = static_cast<uint32_t>(buffers.names.size());
+  header.production_words = static_cast<uint32_t>(buffers.productions.size());
+  header.conflict_words = static_cast<uint32_t>(buffers.conflicts.size());
+
+  const size_t action_count = static_cast<size_t>(image.state_count) * image.terminal_count;
+  const size_t goto_count = static_cast<size_t>(image.state_count) * image.non_terminal_count;
+
+  BinaryWriter writer;
+  writer.put(&header, 1);
+  writer.put(image.name_offsets, buffers.name_offsets.size());
+  writer.put(image.names, buffers.names.size());
+  writer.put(image.production_offsets, buffers.production_offsets.size());
+  writer.put(image.productions, buffers.productions.size());
+  writer.put(image.terminals, image.terminal_count);
+  writer.put(image.non_terminals, image.non_terminal_count);
+  writer.put(image.actions, action_count);
+  writer.put(image.gotos, goto_count);
+  writer.put(image.accept_states, image.accept_count);
+  writer.put(image.conflict_offsets, buffers.conflict_offsets.size());
+  writer.put(image.conflicts, buffers.conflicts.size());
+
+  std::vector<char>& buffer = writer.buffer();
+  const uint32_t file_size = static_cast<uint32_t>(buffer.size());
+  std::memcpy(buffer.data() + offsetof(BinaryHeader, file_size), &file_size, sizeof(file_size));
+
+  std::ofstream out(filename, std::ios::binary);
+  if (!out.is_open()) {
+    std::cerr << "[SLR] 无法写入二进制分析表: " << filename << std::endl;
+    return;
+  }
+  out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+}
+
+// 偏移数组从 0 开始、不减，以 total 结束，相邻两项至少相差 min_length
+static bool valid_offsets(const uint32_t* offsets, size_t count, uint32_t total, uint32_t min_length) {
+  if (offsets[0] != 0 || offsets[count] != total) return false;
+  for (size_t i = 0; i < count; ++i) {
+    if (offsets[i + 1] < offsets[i] || offsets[i + 1] - offsets[i] < min_length) return false;
+  }
+  return true;
+}
+
+// 格子中的动作：移进到已有状态、按已有产生式归约、接受，allow_conflict 时还可以是冲突标记
+static bool valid_entry(ParseTable::Entry entry, const SLRTable::Image& image, bool allow_conflict) {
+  switch (ParseTable::kind(entry)) {
+    case ParseTable::SHIFT:  return ParseTable::target(entry) < image.state_count;
+    case ParseTable::REDUCE: return ParseTable::target(entry) < image.production_count;
+    case ParseTable::ACCEPT: return true;
+    default:                 return allow_conflict && ParseTable::target(entry) <= image.conflict_count;
+  }
+}
+
+// 检查映像内的编号和偏移都在范围内（装入与延迟还原时不再检查）
+static bool valid_image(const SLRTable::Image& image, uint32_t name_bytes, uint32_t production_words, uint32_t conflict_words) {
+  const auto valid_symbol = [&](int64_t id) { return id >= 0 && id < image.symbol_count; };
+  const auto valid_state = [&](int64_t state) { return state >= 0 && state < image.state_count; };
+
+  if (image.method > SLRTable::PAGER) return false;
+  if (!valid_offsets(image.name_offsets, static_cast<size_t>(image.symbol_count) + image.state_count, name_bytes, 0) ||
+      !valid_offsets(image.production_offsets, image.production_count, production_words, 1) ||
+      !valid_offsets(image.conflict_offsets, image.conflict_count, conflict_words, 2)) {
+    return false;
+  }
+
+  for (uint32_t i = 0; i < production_words; ++i) {
+    if (!valid_symbol(image.productions[i])) return false;
+  }
+
+  // 列符号不能重复，也不能同时是终结符和非终结符
+  std::vector<bool> column(image.symbol_count, false);
+  for (const ArrayView<SymbolId>& symbols : {ArrayView<SymbolId>(image.terminals, image.terminal_count),
+                                             ArrayView<SymbolId>(image.non_terminals, image.non_terminal_count)}) {
+    for (SymbolId symbol : symbols) {
+      if (!valid_symbol(symbol) || column[symbol]) return false;
+      column[symbol] = true;
+    }
+  }
+
+  const size_t action_count = static_cast<size_t>(image.state_count) * image.terminal_count;
+  for (size_t i = 0; i < action_count; ++i) {
+    if (!valid_entry(image.actions[i], image, true)) return false;
+  }
+  const size_t goto_count = static_cast<size_t>(image.state_count) * image.non_terminal_count;
+  for (size_t i = 0; i < goto_count; ++i) {
+    if (image.gotos[i] != -1 && !valid_state(image.gotos[i])) return false;
+  }
+
+  for (uint32_t i = 0; i < image.accept_count; ++i) {
+    if (!valid_state(image.accept_states[i])) return false;
+  }
+  if ((image.start_state != -1 && !valid_state(image.start_state)) ||
+      (image.final_accept_state != -1 && !valid_state(image.final_accept_state))) {
+    return false;
+  }
+
+  for (uint32_t i = 0; i < image.conflict_count; ++i) {
+    const uint32_t* begin = image.conflicts + image.conflict_offsets[i];
+    const uint32_t* end = image.conflicts + image.conflict_offsets[i + 1];
+    if (!valid_state(begin[0]) || !valid_symbol(begin[1])) return false;
+    for (const uint32_t* action = begin + 2; action != end; ++action) {
+      if (!valid_entry(*action, image, false)) return false;
+    }
+  }
+  return true;
+}
+
+bool SLRTable::read_binary(const std::string& filename, const std::string& grammar) {
+  // 装入后编译后的分析表直接引用映射的内存，映射随表一起保留
+  auto mapping = std::make_shared<MappedFile>(filename);
+  const MappedFile& file = *mapping;
+  if (!file.is_open()) {
+    return false;
+  }
+
+  BinaryReader reader(file.data(), file.size());
+  const BinaryHeader* header = reader.take<BinaryHeader>(1);
+  if (header == nullptr || std::memcmp(header->magic, BINARY_MAGIC, sizeof(BINARY_MAGIC)) != 0) {
+    std::cerr << "[SLR] 不是二进制分析表: " << filename << std::endl;
+    return false;
+  }
+  if (header->version != BINARY_VERSION) {
+    std::cerr << "[SLR] 二进制分析表版本 " << header->version << " 与当前版本 " << BINARY_VERSION
+              << " 不符: " << filename << std::endl;
+    return false;
+  }
+  if (header->file_size != file.size()) {
+    std::cerr << "[SLR] 二进制分析表已损坏: " << filename << std::endl;
+    return false;
+  }
+  if (header->grammar_checksum != GrammarSet::checksum(grammar)) {
+    std::cerr << "[SLR] 二进制分析表与文法不一致（文法已修改？）: " << filename << std::endl;
+    return false;
+  }
+
+  Image image{};
+  image.grammar_checksum = header->grammar_checksum;
+  image.method = header->method;
+  image.symbol_count = header->symbol_count;
+  image.production_count = header->production_count;
+  image.state_count = header->state_count;
+  image.terminal_count = header->terminal_count;
+  image.non_terminal_count = header->non_terminal_count;
+  image.accept_count = header->accept_count;
+  image.conflict_count = header->conflict_count;
+  image.start_state = header->start_state;
+  image.final_accept_state = header->final_accept_state;
+
+  const size_t name_count = static_cast<size_t>(header->symbol_count) + header->state_count;
+  image.name_offsets = reader.take<uint32_t>(name_count + 1);
+  image.names = reader.take<char>(header->name_bytes);
+  image.production_offsets = reader.take<uint32_t>(static_cast<size_t>(header->production_count) + 1);
+  image.productions = reader.take<int32_t>(header->production_words);
+  image.terminals = reader.take<SymbolId>(header->terminal_count);
+  image.non_terminals = reader.take<SymbolId>(header->non_terminal_count);
+  image.actions = reader.take<ParseTable::Entry>(static_cast<size_t>(header->state_count) * header->terminal_count);
+  image.gotos = reader.take<int32_t>(static_cast<size_t>(header->state_count) * header->non_terminal_count);
+  image.accept_states = reader.take<int32_t>(header->accept_count);
+  image.conflict_offsets = reader.take<uint32_t>(static_cast<size_t>(header->conflict_count) + 1);
+  image.conflicts = reader.take<uint32_t>(header->conflict_words);
+  const bool complete = image.name_offsets && image.names && image.production_offsets && image.productions &&
+                        image.terminals && image.non_terminals && image.actions && image.gotos &&
+                        image.accept_states && image.conflict_offsets && image.conflicts;
+  if (!complete || reader.offset() != file.size() ||
+      !valid_image(image, header->name_bytes, header->production_words, header->conflict_words)) {
+    std::cerr << "[SLR] 二进制分析表已损坏: " << filename << std::endl;
+    return false;
+  }
+
+  if (!load(image)) {
+    return false;
+  }
+  image_owner_ = std::move(mapping);
+  return true;
+}
+
+bool SLRTable::load(const Image& image) {
+  // 符号表：按保存时的 id 重新登记（分析时按名字查符号 id，不能延迟）
+  auto symbols = std::make_shared<SymbolInterner>();
+  for (uint32_t id = 0; id < image.symbol_count; ++id) {
+    std::string name(image.names + image.name_offsets[id], image.name_offsets[id + 1] - image.name_offsets[id]);
+    if (symbols->intern(name) != static_cast<SymbolId>(id)) {
+      std::cerr << "[SLR] 分析表的符号表有重复: " << name << std::endl;
+      return false;
+    }
+  }
+
+  item_cluster_ = ItemCluster();
+  symbols_ = symbols;
+  action_table_.clear();
+  goto_table_.clear();
+  conflicts_.clear();
+  state_to_id_.clear();
+  id_to_state_.clear();
+  grammar_to_id_.clear();
+  id_to_grammar_.clear();
+  accept_states_.clear();
+
+  method_ = static_cast<Method>(image.method);
+  grammar_checksum_ = image.grammar_checksum;
+  start_state_ = image.start_state;
+  final_accept_state_ = image.final_accept_state;
+  accept_states_.insert(image.accept_states, image.accept_states + image.accept_count);
+
+  // 编译后的分析表直接引用映像的稠密数组
+  std::vector<ParseTable::Conflict> conflicts;
+  for (uint32_t i = 0; i < image.conflict_count; ++i) {
+    const uint32_t* begin = image.conflicts + image.conflict_offsets[i];
+    const uint32_t* end = image.conflicts + image.conflict_offsets[i + 1];
+    conflicts.push_back({static_cast<int>(begin[0]), static_cast<SymbolId>(begin[1]),
+                         std::vector<ParseTable::Entry>(begin + 2, end)});
+  }
+  compiled_ = ParseTable(image.state_count,
+                         ArrayView<SymbolId>(image.terminals, image.terminal_count),
+                         ArrayView<SymbolId>(image.non_terminals, image.non_terminal_count),
+                         ArrayView<ParseTable::Entry>(image.actions, static_cast<size_t>(image.state_count) * image.terminal_count),
+                         ArrayView<int32_t>(image.gotos, static_cast<size_t>(image.state_count) * image.non_terminal_count),
+                         std::move(conflicts));
+
+  // map 形式的表、状态名、产生式用到时再还原
+  image_ = image;
+  image_owner_.reset();
+  tables_pending_ = true;
+  productions_pending_ = true;
+  return true;
+}
+
+void SLRTable::restore_tables() const {
+  if (!tables_pending_) return;
+  tables_pending_ = false;
+
+  for (uint32_t state = 0; state < image_.state_count; ++state) {
+    const uint32_t index = image_.symbol_count + state;
+    std::string name(image_.names + image_.name_offsets[index], image_.name_offsets[index + 1] - image_.name_offsets[index]);
+    state_to_id_[name] = static_cast<int>(state);
+    id_to_state_[static_cast<int>(state)] = std::move(name);
+  }
+
+  // map 形式的 ACTION/GOTO 表由稠密数组还原
+  for (uint32_t state = 0; state < image_.state_count; ++state) {
+    ActionIdRow& actions = action_row(static_cast<int>(state));
+    GotoIdRow& gotos = goto_row(static_cast<int>(state));
+    for (SymbolId terminal : compiled_.terminals()) {
+      const ParseTable::Entry entry = compiled_.action(static_cast<int>(state), terminal);
+      if (ParseTable::is_conflict(entry)) {
+        for (ParseTable::Entry action : compiled_.conflict(entry).actions) {
+          actions[terminal].insert(unpack(action));
+        }
+      } else if (!ParseTable::is_error(entry)) {
+        actions[terminal].insert(unpack(entry));
+      }
+    }
+    for (SymbolId non_terminal : compiled_.non_terminals()) {
+      const int target = compiled_.goto_state(static_cast<int>(state), non_terminal);
+      if (target >= 0) {
+        gotos[non_terminal].insert(target);
+      }
+    }
+  }
+
+  // 冲突格子即动作多于一个的格子
+  for (const auto& record : compiled_.conflicts()) {
+    Conflict conflict;
+    conflict.state = record.state;
+    conflict.symbol = symbols_->name(record.symbol);
+    for (ParseTable::Entry action : record.actions) conflict.actions.insert(unpack(action));
+    conflict.type = detect_conflict_type(conflict.actions);
+    conflicts_.insert(conflict);
+  }
+}
+
+void SLRTable::restore_productions() const {
+  if (!productions_pending_) return;
+  productions_pending_ = false;
+
+  for (uint32_t id = 0; id < image_.production_count; ++id) {
+    const int32_t* begin = image_.productions + image_.production_offsets[id];
+    const int32_t* end = image_.productions + image_.production_offsets[id + 1];
+    std::vector<SymbolId> rhs_ids(begin + 1, end);
+    std::vector<std::string> rhs;
+    for (SymbolId symbol : rhs_ids) rhs.push_back(symbols_->name(symbol));
+    Grammar production(symbols_->name(*begin), rhs, *begin, rhs_ids);
+    grammar_to_id_[production] = static_cast<int>(id);
+    id_to_grammar_[static_cast<int>(id)] = std::move(production);
+  }
+}
+
+void SLRTable::drop_image() {
+  if (image_.actions == nullptr) return;
+  compiled_ = ParseTable();
+  image_ = Image{};
+  image_owner_.reset();
+  tables_pending_ = false;
+  productions_pending_ = false;
+}
+
+SLRTable SLRTable::load_or_build(const std::string& filename, const std::string& grammar,
+                                 const std::string& start_symbol, const std::string& fix, bool save) {
+  SLRTable table;
+  if (table.read_binary(filename, grammar)) {
+    return table;
+  }
+  GrammarSet grammar_set(grammar, start_symbol);
+  ItemCluster item_cluster(grammar_set);
+  item_cluster.build();
+  table = SLRTable(item_cluster);
+  table.build();
+  if (!fix.empty() && !table.conflicts().empty()) {
+    table.eliminate_conflict(fix);
+  }
+  if (save) {
+    table.to_binary(filename);
+  }
+  return table;
+}
+
+// 以 C++ 字面量输出数组，空数组补一个 0（C++ 不允许长度为 0 的数组）
+template <typename T>
+static void write_array(std::ostream& out, const char* type, const std::string& name, const T* data, size_t count) {
+  out << "inline constexpr " << type << " " << name << "[] = {";
+  for (size_t i = 0; i < count; ++i) {
+    out << (i % 16 == 0 ? "\n  " : " ") << static_cast<int64_t>(data[i]) << (i + 1 < count ? "," : "");
+  }
+  out << (count == 0 ? "0};\n\n" : "\n};\n\n");
+}
+
+void SLRTable::to_header(const std::string& filename, const std::string& name) const {
+  std::ofstream out(filename);
+  if (!out.is_open()) {
+    std::cerr << "[SLR] 无法写入分析表头文件: " << filename << std::endl;
+    return;
+  }
+
+  ImageBuffers buffers;
+  const Image image = this->image(buffers);
+  const size_t action_count = static_cast<size_t>(image.state_count) * image.terminal_count;
+  const size_t goto_count = static_cast<size_t>(image.state_count) * image.non_terminal_count;
+
+  std::string guard = strtool::to_upper(name) + "_GENERATED_HPP";
+  out << "// 由 SLRTable::to_header 生成，请勿手动修改\n";
+  out << "#ifndef " << guard << "\n#define " << guard << "\n\n";
+  out << "#include \"basic/slr_table.hpp\"\n\n";
+  out << "namespace generated {\n\n";
+
+  // 名字每个一行；可打印的 ASCII 原样输出，其余字节（如 UTF-8 的 ε、∧）用三位八进制转义
+  out << "inline constexpr char " << name << "_names[] =";
+  for (uint32_t i = 0; i + 1 < buffers.name_offsets.size(); ++i) {
+    out << "\n  \"";
+    for (uint32_t j = buffers.name_offsets[i]; j < buffers.name_offsets[i + 1]; ++j) {
+      const unsigned char ch = static_cast<unsigned char>(buffers.names[j]);
+      if (ch >= 0x20 && ch < 0x7f && ch != '\\' && ch != '"' && ch != '?') {
+        out << ch;
+      } else {
+        char escaped[5];
+        std::snprintf(escaped, sizeof(escaped), "\\%03o", ch);
+        out << escaped;
+      }
+    }
+    out << "\"";
+  }
+  out << (buffers.name_offsets.size() == 1 ? " \"\";\n\n" : ";\n\n");
+
+  write_array(out, "uint32_t", name + "_name_offsets", image.name_offsets, buffers.name_offsets.size());
+  write_array(out, "uint32_t", name + "_production_offsets", image.production_offsets, buffers.production_offsets.size());
+  write_array(out, "int32_t", name + "_productions", image.productions, buffers.productions.size());
+  write_array(out, "SymbolId", name + "_terminals", image.terminals, image.terminal_count);
+  write_array(out, "SymbolId", name + "_non_terminals", image.non_terminals, image.non_terminal_count);
+  write_array(out, "ParseTable::Entry", name + "_actions", image.actions, action_count);
+  write_array(out, "int32_t", name + "_gotos", image.gotos, goto_count);
+  write_array(out, "int32_t", name + "_accept_states", image.accept_states, image.accept_count);
+  write_array(out, "uint32_t", name + "_conflict_offsets", image.conflict_offsets, buffers.conflict_offsets.size());
+  write_array(out, "uint32_t", name + "_conflicts", image.conflicts, buffers.conflicts.size());
+
+  out << "inline constexpr SLRTable::Image " << name << " = {\n"
+      << "  " << image.grammar_checksum << "ull, " << image.method << ",\n"
+      << "  " << image.symbol_count << ", " << image.production_count << ", " << image.state_count << ", "
+      << image.terminal_count << ", " << image.non_terminal_count << ", " << image.accept_count << ", "
+      << image.conflict_count << ",\n"
+      << "  " << image.start_state << ", " << image.final_accept_state << ",\n";
+  for (const char* field : {"name_offsets", "names", "production_offsets", "productions", "terminals",
+                            "non_terminals", "actions", "gotos", "accept_states", "conflict_offsets"}) {
+    out << "  " << name << "_" << field << ",\n";
+  }
+  out << "  " << name << "_conflicts\n};\n\n";
+  out << "} // namespace generated\n\n#endif // " << guard << "\n";
+}
+
+bool SLRTable::load_generated() {
+#ifdef SLR_TABLE_GENERATED_HEADER
+  return load(generated::slr_table);
+#else
+  return false;
+#endif
+}
+
 void SLRTable::assign_ids(const ItemCluster& cluster) {
   GrammarSet grammar_set = cluster.grammar_set();
   std::vector<std::string> state_names;
@@ -690,14 +1543,15 @@ void SLRTable::assign_ids(const ItemCluster& cluster) {
 
   // 给扩展文法 S' -> S 分配编号
   Grammar augmented_start(grammar_set.start_symbol() + "'", { grammar_set.start_symbol() });
+  augmented_start.bind(grammar_set.symbols());
   grammar_to_id_[augmented_start] = prod_idx;
   id_to_grammar_[prod_idx] = augmented_start;
 
   // 初始化ACTION和GOTO表
   for (const auto& name : state_names) {
     int state_id = state_to_id_.at(name);
-    action_table_[state_id] = {};
-    goto_table_[state_id] = {};
+    action_row(state_id).clear();
+    goto_row(state_id).clear();
   }
 }
 
@@ -730,7 +1584,7 @@ void SLRTable::compute_states(const ItemCluster& cluster) {
     // 再看闭包（closure）里有没有最终接受（S'→S·）
     for (const auto& [lhs, items] : state.closure.items()) {
       for (const auto& item : items) {
-        if (item.completed() && lhs == augmented_start) {
+        if (item.completed() && item.lhs() == augmented_start) {
           final_accept_state_ = state_id;
         }
       }
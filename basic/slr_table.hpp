@@ -3,12 +3,18 @@
 
 #include "item.hpp"
 #include "grammar.hpp"
+#include "parse_table.hpp"
+#include "lalr.hpp"
+#include "lr1.hpp"
 #include <unordered_map>
+#include <memory>
 #include <string>
 #include <iostream>
 
 const std::string SLR_TABLE_NORMAL = "input/slr_table/slr_table_normal.csv";
 const std::string SLR_TABLE_EXTEND = "input/slr_table/slr_table_extend.csv";
+const std::string SLR_TABLE_EXTEND_BINARY = "output/slr_table/slr_table_extend.bin";
+const std::string SLR_CONFLICT_EXTEND = "output/slr_table/conflict_after.csv";
 
 // SLR分析表
 class SLRTable {
@@ -19,6 +25,13 @@ public:
   // 冲突类型
   enum ConflictType { SHIFT_REDUCE, REDUCE_REDUCE, SHIFT_SHIFT, UNKNOWN };
 
+  // 构建方法：
+  //   SLR   LR(0) 自动机 + FOLLOW 集
+  //   LALR  LR(0) 自动机 + LALR(1) 向前看符号
+  //   LR1   规范 LR(1) 自动机（替换传入的 ItemCluster）
+  //   PAGER 按 Pager 弱相容合并的 LR(1) 自动机（替换传入的 ItemCluster）
+  enum Method { SLR, LALR, LR1, PAGER };
+
   struct Action {
     ActionType type;
     int target;
@@ -92,6 +105,9 @@ public:
   // 获取某个状态的在某个符号下的ACTION表
   const ActionSet* get_action(int state, const std::string& symbol) const;
 
+  // 按符号 id 查询 ACTION 表
+  const ActionSet* get_action(int state, SymbolId symbol) const;
+
   // 获取某个状态的ACTION表
   ActionRow get_action(int state) const;
 
@@ -101,6 +117,9 @@ public:
   // 获取某个状态的在某个符号下GOTO表
   const GotoSet* get_goto(int state, const std::string& non_terminal) const;
 
+  // 按符号 id 查询 GOTO 表
+  const GotoSet* get_goto(int state, SymbolId non_terminal) const;
+
   // 获取某个状态的GOTO表
   GotoRow get_goto(int state) const;
 
@@ -109,9 +128,11 @@ public:
 
   // 添加ACTION表项
   void add_action(int state, const std::string& symbol, ActionType type, int target);
+  void add_action(int state, SymbolId symbol, ActionType type, int target);
 
   // 添加GOTO表项
   void add_goto(int state, const std::string& non_terminal, int next_state);
+  void add_goto(int state, SymbolId non_terminal, int next_state);
 
   // 设置ACTION项
   void set_action(int state, const std::string& symbol, ActionType type, int target);
@@ -128,6 +149,28 @@ public:
   int final_accept_state() const;
   const ConflictSet& conflicts() const;
 
+  // 获取编译后的只读分析表（build()/read_csv()/eliminate_conflict() 之后自动生成）
+  const ParseTable& compiled() const { return compiled_; }
+
+  // 由当前 ACTION/GOTO 表重新生成编译后的分析表
+  void compile();
+
+  // 生成压缩分析表（行位移 + 默认归约），exact 含义见 CompressedParseTable
+  CompressedParseTable compress(bool exact = true) const { return CompressedParseTable(compiled_, exact); }
+
+  // map 形式的 ACTION/GOTO 表占用的字节数（按 libstdc++ 节点布局估算）
+  size_t map_bytes() const;
+
+  // 输出 map / 稠密 / 压缩三种形式的字节数
+  void table_bytes_to_txt(const std::string &filename) const;
+
+  // Action 与编译后的 32 位格子互转
+  static ParseTable::Entry pack(const Action& action);
+  static Action unpack(ParseTable::Entry entry);
+
+  // 获取符号驻留表（与 ItemCluster 的文法集共享）
+  const SymbolInterner& symbols() const { return *symbols_; }
+
   // 获取ItemSet/Grammar到编号的映射
   const std::unordered_map<std::string, int>& state_to_id() const;
   const std::unordered_map<Grammar, int, Grammar::Hash>& grammar_to_id() const;
@@ -145,6 +188,16 @@ public:
   Grammar find_grammar(int id) const;
   int find_grammar(const Grammar &grammar) const;
 
+  // 产生式编号的上界、产生式左部的符号 id 与右部长度（空产生式为 0），没有该产生式时为 NO_SYMBOL / -1
+  // 装入的表直接从映像读取，不必还原产生式
+  size_t production_count() const;
+  SymbolId production_lhs(int id) const;
+  int production_length(int id) const;
+
+  // 选择构建方法（默认 SLR），在 build() 之前设置
+  void set_method(Method method) { method_ = method; }
+  Method method() const { return method_; }
+
   // IMPORTANT: 核心
   // 使用类中的ItemCluster构建
   void build();
@@ -176,24 +229,116 @@ public:
   // 读取CSV文件
   void read_csv(const std::string& file);
 
+  // 分析表的只读映像：二进制分析表映射后的各段，或生成的头文件中的 constexpr 数组
+  struct Image {
+    uint64_t grammar_checksum;     // 文法源文本的校验和
+    uint32_t method;               // 构建方法
+    uint32_t symbol_count;         // 符号数（按 id）
+    uint32_t production_count;     // 产生式数（按编号）
+    uint32_t state_count;          // 状态数
+    uint32_t terminal_count;       // ACTION 列数
+    uint32_t non_terminal_count;   // GOTO 列数
+    uint32_t accept_count;         // 接受状态数
+    uint32_t conflict_count;       // 冲突格子数
+    int32_t start_state;           // 起始状态
+    int32_t final_accept_state;    // 最终接受状态
+    const uint32_t* name_offsets;  // [symbol_count + state_count + 1]：符号名（按 id）、状态名（按编号）在 names 中的偏移
+    const char* names;             // 名字字节，不含结尾的 0
+    const uint32_t* production_offsets; // [production_count + 1]
+    const int32_t* productions;    // 每个产生式：左部 id, 右部 id...
+    const SymbolId* terminals;     // ACTION 列 -> 符号 id
+    const SymbolId* non_terminals; // GOTO 列 -> 符号 id
+    const ParseTable::Entry* actions; // [state_count * terminal_count]
+    const int32_t* gotos;          // [state_count * non_terminal_count]
+    const int32_t* accept_states;  // [accept_count]
+    const uint32_t* conflict_offsets; // [conflict_count + 1]
+    const uint32_t* conflicts;     // 每个冲突格子：状态, 符号 id, 动作...
+  };
+
+  // 二进制分析表的格式版本，布局变化时加一
+  static constexpr uint32_t BINARY_VERSION = 1;
+
+  // 保存为二进制分析表：文件头（含构建所用文法源文本的校验和）加 Image 的各数组（按本机字节序）
+  void to_binary(const std::string& filename) const;
+
+  // 映射二进制分析表并直接装入，不经过文法/项目集/CSV 解析，编译后的分析表引用映射的内存
+  // grammar 为文法文本或文件（同 GrammarSet 的构造），校验和不一致、版本不符或文件损坏
+  // （含偏移不单调、符号/状态/产生式编号越界）时返回 false，表保持不变
+  // 加载后没有 ItemCluster，find_item_set() 等依赖项目集的接口不可用
+  bool read_binary(const std::string& filename, const std::string& grammar);
+
+  // 优先映射二进制分析表 filename；没有、文法已修改或文件损坏时由文法 grammar（开始符号 start_symbol）
+  // 按 SLR 方法重新构建，仍有冲突且给出 fix 时用 eliminate_conflict(fix) 修正，save 为真时再保存到 filename
+  // （二进制表只校验文法，修改 fix 后需删除 filename 重新构建）
+  static SLRTable load_or_build(const std::string& filename, const std::string& grammar,
+                                const std::string& start_symbol, const std::string& fix = "",
+                                bool save = false);
+
+  // 保存为 C++ 头文件：Image 的各数组为 generated 命名空间中的 constexpr 数组，映像名为 name
+  void to_header(const std::string& filename, const std::string& name = "slr_table") const;
+
+  // 从映像装入：编译后的分析表直接引用映像的数组，映像须在表的生命周期内有效
+  // map 形式的 ACTION/GOTO 表、状态名和产生式在第一次用到时才由映像还原
+  bool load(const Image& image);
+
+  // 装入编译进 basic 的 generated::slr_table（定义了 SLR_TABLE_GENERATED_HEADER 时），否则返回 false
+  bool load_generated();
+
+  // 构建所用文法源文本的校验和（见 GrammarSet::source_checksum）
+  uint64_t grammar_checksum() const { return grammar_checksum_; }
+
 private:
   ItemCluster item_cluster_; // 保存自己的ItemCluster
 
-  // ACTION表：state -> (symbol -> 动作列表)
-  std::unordered_map<int, ActionRow> action_table_;
+  // 符号驻留表，表项按符号 id 存放
+  SymbolInternerPtr symbols_ = item_cluster_.grammar_set().symbols_ptr();
+
+  using ActionIdRow = std::unordered_map<SymbolId, ActionSet, SymbolNameHash>;
+  using GotoIdRow = std::unordered_map<SymbolId, GotoSet, SymbolNameHash>;
+
+  // 以下 mutable 成员对装入的表是由映像延迟还原的缓存（见 restore_tables/restore_productions）
 
-  // GOTO表：state -> (非终结符 -> 目标状态)
-  std::unordered_map<int, GotoRow> goto_table_;
+  // ACTION表：state -> (symbol id -> 动作列表)
+  mutable std::unordered_map<int, ActionIdRow> action_table_;
+
+  // GOTO表：state -> (非终结符 id -> 目标状态)
+  mutable std::unordered_map<int, GotoIdRow> goto_table_;
 
   int start_state_;  // 起始状态编号
   std::unordered_set<int> accept_states_; // 所有接受状态编号集合
   int final_accept_state_; // 最终接受状态（S'->S的状态编号）
-  ConflictSet conflicts_; // 冲突列表
+  mutable ConflictSet conflicts_; // 冲突列表
+  ParseTable compiled_; // 编译后的分析表
+  Method method_ = SLR; // 构建方法
+  uint64_t grammar_checksum_ = 0; // 文法源文本的校验和
+
+  mutable std::unordered_map<std::string, int> state_to_id_; // ItemSet名字 -> 状态编号
+  mutable std::unordered_map<Grammar, int, Grammar::Hash> grammar_to_id_; // Grammar -> 产生式编号
+  mutable std::unordered_map<int, std::string> id_to_state_; // 状态编号 -> ItemSet名字
+  mutable std::unordered_map<int, Grammar> id_to_grammar_; // 产生式编号 -> Grammar
+
+  // 装入的映像；image_owner_ 持有映像所在的内存（映射的二进制文件），生成的头文件为空
+  Image image_{};
+  std::shared_ptr<const void> image_owner_;
+  mutable bool tables_pending_ = false;      // ACTION/GOTO 表、冲突、状态名尚未由映像还原
+  mutable bool productions_pending_ = false; // 产生式尚未由映像还原
+
+  // 由映像还原 map 形式的表和状态名 / 产生式，已还原或不是装入的表时什么也不做
+  void restore_tables() const;
+  void restore_productions() const;
 
-  std::unordered_map<std::string, int> state_to_id_; // ItemSet名字 -> 状态编号
-  std::unordered_map<Grammar, int, Grammar::Hash> grammar_to_id_; // Grammar -> 产生式编号
-  std::unordered_map<int, std::string> id_to_state_; // 状态编号 -> ItemSet名字
-  std::unordered_map<int, Grammar> id_to_grammar_; // 产生式编号 -> Grammar
+  // 丢弃映像（重新构建或读入之前调用），未还原的部分不再还原
+  void drop_image();
+
+  // 生成 Image 时需要另外存放的数组
+  struct ImageBuffers;
+
+  // 当前分析表的映像，数组指向 buffers 和 compiled_
+  Image image(ImageBuffers& buffers) const;
+
+  // 获取（必要时创建）某个状态的 ACTION/GOTO 行
+  ActionIdRow& action_row(int state) const;
+  GotoIdRow& goto_row(int state) const;
 
   // 分配状态编号和产生式编号
   void assign_ids(const ItemCluster& cluster);
@@ -204,6 +349,11 @@ private:
   // 计算冲突
   int compute_conflict();
 
+  // 按文法的优先级/结合性声明消解移进-归约冲突（没有声明时不做任何事）
+  // 只消解双方都有声明的移进-归约格子；未声明的和归约-归约的格子保留为冲突并逐个报告
+  // 返回 {按优先级消解数, 保留冲突数}
+  std::pair<int, int> resolve_precedence(const GrammarSet& grammar_set);
+
   void parse_stream(const std::string& content);
 
   // 辅助函数：检测冲突类型
@@ -0,0 +1,29 @@
+#include "symbol_interner.hpp"
+#include <stdexcept>
+
+SymbolInterner::SymbolInterner() {
+  intern("ε");
+  intern("#");
+}
+
+SymbolId SymbolInterner::intern(const std::string& name) {
+  auto it = ids_.find(name);
+  if (it != ids_.end()) return it->second;
+  SymbolId id = static_cast<SymbolId>(names_.size());
+  names_.push_back(name);
+  hashes_.push_back(std::hash<std::string>{}(name));
+  ids_.emplace(name, id);
+  return id;
+}
+
+SymbolId SymbolInterner::find(const std::string& name) const {
+  auto it = ids_.find(name);
+  return it == ids_.end() ? NO_SYMBOL : it->second;
+}
+
+const std::string& SymbolInterner::name(SymbolId id) const {
+  if (id < 0 || static_cast<size_t>(id) >= names_.size()) {
+    throw std::out_of_range("Symbol id " + std::to_string(id) + " not found.");
+  }
+  return names_[id];
+}
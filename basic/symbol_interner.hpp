@@ -0,0 +1,62 @@
+#ifndef SYMBOL_INTERNER_HPP
+#define SYMBOL_INTERNER_HPP
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <memory>
+#include <functional>
+
+// 文法符号的整数 id，-1 表示未绑定
+using SymbolId = int;
+constexpr SymbolId NO_SYMBOL = -1;
+
+// 符号驻留表：为文法中的每个终结符/非终结符分配稠密的整数 id
+// 由 GrammarSet 创建，GrammarSet 的副本、ItemCluster、SLRTable 共享同一张表
+// 只增不删，已分配的 id 永远有效
+class SymbolInterner {
+public:
+  static constexpr SymbolId EPSILON = 0; // "ε"
+  static constexpr SymbolId END = 1;     // "#"
+
+  // 默认构造函数：预先登记 ε 和 #
+  SymbolInterner();
+
+  // 登记符号，已存在则返回原 id
+  SymbolId intern(const std::string& name);
+
+  // 查找符号，不存在返回 NO_SYMBOL
+  SymbolId find(const std::string& name) const;
+
+  // id -> 符号名
+  const std::string& name(SymbolId id) const;
+
+  // 符号名的哈希：登记时算好存放在 hashes_ 中，按 id 查询不再对字符串求哈希
+  // 未登记的 id（如 NO_SYMBOL）没有符号名，返回 id 本身的哈希，按 id 查找时总能安全地得到“不存在”
+  size_t hash(SymbolId id) const {
+    return id >= 0 && static_cast<size_t>(id) < hashes_.size() ? hashes_[id] : std::hash<SymbolId>{}(id);
+  }
+
+  // 已登记的符号数
+  size_t size() const { return names_.size(); }
+
+private:
+  std::vector<std::string> names_;                  // id -> 符号名
+  std::vector<size_t> hashes_;                      // id -> std::hash<std::string>(符号名)
+  std::unordered_map<std::string, SymbolId> ids_;   // 符号名 -> id
+};
+
+using SymbolInternerPtr = std::shared_ptr<SymbolInterner>;
+
+// 以符号名的哈希作为 id 的哈希，
+// 使按 id 索引的 unordered 容器与原先按字符串索引时的遍历顺序一致（输出文件保持不变）；
+// 哈希取自 SymbolInterner 的缓存，查找时不访问符号名
+struct SymbolNameHash {
+  const SymbolInterner* symbols = nullptr;
+
+  size_t operator()(SymbolId id) const {
+    return symbols->hash(id);
+  }
+};
+
+#endif // SYMBOL_INTERNER_HPP
@@ -4,6 +4,7 @@
 
 #include "syntax.hpp"
 #include "utils/strtool.hpp"
+#include <algorithm>
 
 void Syntax::Table::add_entry(const EntryPtr &entry) {
   // 检查是否重名
@@ -108,9 +109,7 @@ std::ostream & operator<<(std::ostream &os, const Syntax::Table &symbol_table) {
   }
   os << "  }" << std::endl;
   os << "  code: [" << std::endl;
-  for (const auto& code : symbol_table.code) {
-    os << code;
-  }
+  print_tac(os, symbol_table.code);
   os << "  ]" << std::endl;
   os << "}" << std::endl;
   return os;
@@ -130,16 +129,27 @@ std::ostream& operator<<(std::ostream& os, const Syntax& analyzer) {
 
 Syntax::Syntax(const SLRTable& slr_table)
   : slr_table_(slr_table) {
-
+  // 预先算好每个产生式的右部长度和左部 id，归约时按编号直接取
+  const size_t count = slr_table_.production_count();
+  rhs_length_.assign(count, -1);
+  lhs_id_.assign(count, NO_SYMBOL);
+  for (size_t id = 0; id < count; ++id) {
+    rhs_length_[id] = slr_table_.production_length(static_cast<int>(id));
+    lhs_id_[id] = slr_table_.production_lhs(static_cast<int>(id));
+  }
 }
 
 bool Syntax::parse(const std::vector<Lexical::Token>& tokens) {
   return analyze_tokens(tokens);
 }
 
+bool Syntax::parse(const std::vector<Lexical::Token>& tokens, const Lexical& lexical) {
+  return analyze_tokens(tokens, &lexical);
+}
+
 bool Syntax::parse_file(const std::string& filename, Lexical lexical) {
   const std::vector<Lexical::Token> tokens = lexical.analyze(filename);
-  return analyze_tokens(tokens);
+  return analyze_tokens(tokens, &lexical);
 }
 
 void Syntax::processes_to_txt(const std::string &filename) const {
@@ -162,114 +172,141 @@ void Syntax::symbol_table_to_txt(const std::string &filename) const {
   }
 }
 
-bool Syntax::analyze_tokens(const std::vector<Lexical::Token>& tokens) {
+bool Syntax::analyze_tokens(const std::vector<Lexical::Token>& tokens, const Lexical* lexical) {
   processes_.clear();
+  if (record_processes_) processes_.reserve(tokens.size() * 2);
+
+  // 输入结束符 #，不再复制整个记号序列
+  static const Lexical::Token end_token{ "#", "#" };
+
+  const ParseTable& table = slr_table_.compiled();
+  const SymbolInterner& symbols = slr_table_.symbols();
+  const SymbolId newline_id = symbols.find("NEWLINE");
+
+  // 类型 id -> 文法符号 id，每种类型只按名字查一次；类型为 NEWLINE 的记号跳过
+  std::vector<SymbolId> type_symbols;
+  uint32_t newline_type = Lexical::NO_TYPE;
+  if (lexical != nullptr) {
+    type_symbols = lexical->symbol_ids(symbols);
+    const int type = lexical->type_id("NEWLINE");
+    if (type >= 0) newline_type = static_cast<uint32_t>(type);
+  }
 
-  // 添加输入结束符 #
-  std::vector<Lexical::Token> tokens_ = tokens;
-  tokens_.push_back({ "#", "#" });
-
-  // 状态栈和符号栈
-  std::stack<int> state_stack;
-  std::stack<SymbolPtr> stack_token;
+  // 状态栈和符号栈：连续存放，预留空间
+  std::vector<int> state_stack;
+  std::vector<SymbolPtr> stack_token;
+  state_stack.reserve(256);
+  stack_token.reserve(256);
+
+  // 语义值都构造在内存池中，分析结束（包括出错返回）时统一析构，块留给下次分析复用
+  struct ArenaReset {
+    Arena& arena;
+    ~ArenaReset() { arena.reset(); }
+  } arena_reset{ *arena_ };
+  arena_->reset();
+
+  // 从 pos 开始找下一个输入符号（跳过换行符），返回其 id，输入结束时为 #
+  auto next_symbol = [&](size_t& pos) -> SymbolId {
+    for (; pos < tokens.size(); ++pos) {
+      const Lexical::Token& token = tokens[pos];
+      if (token.type_id < type_symbols.size()) {
+        if (token.type_id != newline_type) return type_symbols[token.type_id];
+        continue;
+      }
+      const SymbolId id = symbols.find(token.type);
+      if (id != newline_id || token.type != "NEWLINE") return id;
+    }
+    return SymbolInterner::END;
+  };
 
   // 初始状态入栈
-  state_stack.push(slr_table_.start_state());
+  state_stack.push_back(slr_table_.start_state());
 
   size_t pos = 0;
+  SymbolId symbol = next_symbol(pos);
 
   while (true) {
-    // 跳过换行符
-    while (pos < tokens_.size() && tokens_[pos].type == "NEWLINE") {
-      ++pos;
-    }
-
     // 获取当前状态与当前输入符号
-    int current_state = state_stack.top();
-    std::string symbol = tokens_[pos].type;
+    const int current_state = state_stack.back();
+    const Lexical::Token& token = pos < tokens.size() ? tokens[pos] : end_token;
 
-    // 查表获取 ACTION 集合
-    const auto* action_set = slr_table_.get_action(current_state, symbol);
+    // 查编译后的 ACTION 表
+    const ParseTable::Entry entry = table.action(current_state, symbol);
 
-    if (!action_set || action_set->empty()) {
-      std::cerr << "[Syntax] 状态 " << current_state << " 符号 " << tokens_[pos].lexeme << " 无效" << std::endl;
+    if (ParseTable::is_error(entry)) {
+      std::cerr << "[Syntax] 状态 " << current_state << " 符号 " << token.lexeme << " 无效" << std::endl;
       return false;
     }
 
-    if (action_set->size() > 1) {
-      std::cerr << "[冲突] 状态 " << current_state << " 符号 '" << symbol << "' 有多个动作，冲突如下：" << std::endl;
-      for (const auto& act : *action_set) {
-        std::cerr << "  -> " << act << std::endl;
+    if (ParseTable::is_conflict(entry)) {
+      std::cerr << "[冲突] 状态 " << current_state << " 符号 '" << token.type << "' 有多个动作，冲突如下：" << std::endl;
+      for (const auto& act : table.conflict(entry).actions) {
+        std::cerr << "  -> " << SLRTable::unpack(act) << std::endl;
       }
       return false;
     }
 
-    const auto& action = *action_set->begin();
-    processes_.push_back({ current_state, tokens_[pos], action });
+    if (record_processes_) {
+      processes_.push_back({ current_state, token, SLRTable::unpack(entry) });
+    }
+
+    const int target = static_cast<int>(ParseTable::target(entry));
 
-    if (action.type == SLRTable::SHIFT) {
+    if (ParseTable::kind(entry) == ParseTable::SHIFT) {
       // 执行移进动作：状态入栈，符号入栈，向前移动输入
-      state_stack.push(action.target);
-      stack_token.push(std::make_shared<Symbol>(tokens_[pos]));
+      state_stack.push_back(target);
+      stack_token.push_back(make<Symbol>(token));
 
-      if (!shift(action.target, tokens_[pos])) {
-        std::cerr << "[错误] 子类 shift(" << action.target << ") 执行失败。" << std::endl;
+      if (!shift(target, token)) {
+        std::cerr << "[错误] 子类 shift(" << target << ") 执行失败。" << std::endl;
         return false;
       }
 
-      ++pos;
+      symbol = next_symbol(++pos);
     }
-    else if (action.type == SLRTable::REDUCE) {
-      // 执行归约动作
-      const Grammar& g = slr_table_.find_grammar(action.target);
-      const auto& rhs = g.rhs();
-
-      bool is_epsilon = (rhs.empty() || (rhs.size() == 1 && rhs[0] == "ε"));
-
-      std::vector<SymbolPtr> reduced_tokens;
-
-      // 弹出归约右部符号
-      if (!is_epsilon) {
-        for (size_t i = 0; i < rhs.size(); ++i) {
-          if (!state_stack.empty()) state_stack.pop();
-          if (!stack_token.empty()) {
-            reduced_tokens.push_back(stack_token.top());
-            stack_token.pop();
-          }
-        }
-        std::reverse(reduced_tokens.begin(), reduced_tokens.end());
+    else if (ParseTable::kind(entry) == ParseTable::REDUCE) {
+      // 执行归约动作：右部长度和左部 id 按产生式编号取
+      const int length = target < static_cast<int>(rhs_length_.size()) ? rhs_length_[target] : -1;
+      if (length < 0) {
+        std::cerr << "[错误] 归约 " << target << " 无对应产生式。" << std::endl;
+        return false;
       }
 
-      if (state_stack.empty()) {
+      if (state_stack.size() <= static_cast<size_t>(length)) {
         std::cerr << "[错误] 归约时状态栈为空。" << std::endl;
         return false;
       }
 
+      // 弹出归约右部符号
+      reduce_args_.assign(stack_token.end() - length, stack_token.end());
+      stack_token.resize(stack_token.size() - length);
+      state_stack.resize(state_stack.size() - length);
+
       // 查 GOTO 表获取新状态
-      int top_state = state_stack.top();
-      const auto* goto_set = slr_table_.get_goto(top_state, g.lhs());
+      const int top_state = state_stack.back();
+      const int goto_state = table.goto_state(top_state, lhs_id_[target]);
 
-      if (!goto_set || goto_set->empty()) {
-        std::cerr << "[错误] GOTO(" << top_state << ", " << g.lhs() << ") 无目标状态。" << std::endl;
+      if (goto_state < 0) {
+        std::cerr << "[错误] GOTO(" << top_state << ", " << slr_table_.find_grammar(target).lhs() << ") 无目标状态。" << std::endl;
         return false;
       }
 
       // 新状态入栈
-      state_stack.push(*goto_set->begin());
+      state_stack.push_back(goto_state);
 
       // 调用 reduce，生成归约后的符号对象
-      SymbolPtr lhs_symbol = reduce(action.target, reduced_tokens);
+      SymbolPtr lhs_symbol = reduce(target, reduce_args_);
 
       // 判断返回是否有效
       if (!lhs_symbol || lhs_symbol->name.empty()) {
-        std::cerr << "[错误] 归约 " << action.target << " 错误，返回空符号。" << std::endl;
+        std::cerr << "[错误] 归约 " << target << " 错误，返回空符号。" << std::endl;
         return false;
       }
 
       // 归约后的非终结符入栈
-      stack_token.push(lhs_symbol);
+      stack_token.push_back(lhs_symbol);
     }
-    else if (action.type == SLRTable::ACCEPT) {
+    else if (ParseTable::kind(entry) == ParseTable::ACCEPT) {
       // 接受状态
       std::cout << "[信息] 输入分析成功，状态 " << current_state << " 接受。" << std::endl;
       return true;
@@ -293,9 +330,14 @@ SyntaxZyl::SyntaxZyl(const SLRTable& slr_table) : Syntax(slr_table) {
   system_table->rtype = "VOID";
   stack_symbol_table_.push(system_table);
   map_symbol_table_["system_table"] = system_table;
-  // 添加文法到属性方程的映射
+  // 添加文法到属性方程的映射：按分析表中的产生式编号登记
+  reduce_handlers_.assign(rhs_length_.size(), nullptr);
   // 文法 1
   add_equation(Grammar("P -> D' S'"), &SyntaxZyl::reduce_program);
+  // 文法 2
+  add_equation(Grammar("D' -> ε"), &SyntaxZyl::reduce_declarations);
+  // 文法 3
+  add_equation(Grammar("D' -> D' D ;"), &SyntaxZyl::reduce_declarations);
   // 文法 4
   add_equation(Grammar("D -> T d"), &SyntaxZyl::reduce_declaration_var);
   // 文法 5
@@ -385,6 +427,21 @@ SyntaxZyl::SyntaxZyl(const SLRTable& slr_table) : Syntax(slr_table) {
   add_equation(Grammar("E -> E - E"), &SyntaxZyl::reduce_expr_operator);
   // 文法 47
   add_equation(Grammar("E -> E / E"), &SyntaxZyl::reduce_expr_operator);
+
+  // ACTION 表中会被归约却没有属性方程的产生式，构造时报告，归约到它们时分析失败
+  // （拓广产生式 P' -> P 只接受不归约，不报告）
+  std::vector<bool> reducible(reduce_handlers_.size(), false);
+  for (const ParseTable::Entry entry : slr_table_.compiled().actions()) {
+    if (ParseTable::kind(entry) == ParseTable::REDUCE && ParseTable::target(entry) < reducible.size()) {
+      reducible[ParseTable::target(entry)] = true;
+    }
+  }
+  for (size_t id = 0; id < reduce_handlers_.size(); ++id) {
+    if (reducible[id] && !reduce_handlers_[id]) {
+      std::cerr << "[Syntax] 产生式 " << id << " " << slr_table_.find_grammar(static_cast<int>(id))
+                << " 没有属性方程" << std::endl;
+    }
+  }
 }
 
 // 根据不同的属性方程, 由程序员实现函数的定义, 父类提供接口.
@@ -398,11 +455,18 @@ Syntax::SymbolPtr SyntaxZyl::reduce_program(const std::vector<SymbolPtr> &symbol
   // 文法 1
   // P -> D' S'
   //      0  1
-  SListPtr symbol_sc = std::dynamic_pointer_cast<SymbolSList>(symbols[1]);
+  SListPtr symbol_sc = as<SymbolSList>(symbols[1]);
   TablePtr symbol_table = stack_symbol_table_.top();
-  symbol_table->code = symbol_sc->code;
-  SymbolP symbol_p = SymbolP("P", "P", {symbol_sc->code});
-  return std::make_shared<SymbolP>(symbol_p);
+  symbol_table->code = symbol_sc->code.instructions();
+  return make<SymbolP>("P", "P", symbol_sc->code);
+}
+
+Syntax::SymbolPtr SyntaxZyl::reduce_declarations(const std::vector<SymbolPtr> & /*symbols*/) {
+  // 文法 2, 3
+  // D' -> ε
+  // D' -> D' D ;
+  // 声明在归约 D 时已登记到符号表，这里只占位
+  return make<Symbol>("D'", "D'");
 }
 
 Syntax::SymbolPtr SyntaxZyl::reduce_declaration_var(const std::vector<SymbolPtr> &symbols) {
@@ -411,7 +475,7 @@ Syntax::SymbolPtr SyntaxZyl::reduce_declaration_var(const std::vector<SymbolPtr>
   //      0 1
   TablePtr symbol_table = stack_symbol_table_.top();
   EntryPtr entry = std::make_shared<Entry>();
-  TPtr symbol_t = std::dynamic_pointer_cast<SymbolT>(symbols[0]);
+  TPtr symbol_t = as<SymbolT>(symbols[0]);
 
   entry->name = symbols[1]->value;
   entry->type = symbol_t->type;
@@ -421,8 +485,7 @@ Syntax::SymbolPtr SyntaxZyl::reduce_declaration_var(const std::vector<SymbolPtr>
 
   entry->offset = symbol_table->width;
 
-  SymbolD symbol_d = SymbolD("D", "D", {symbols[1]->value});
-  return std::make_shared<SymbolD>(symbol_d);
+  return make<SymbolD>("D", "D", std::vector<std::string>{symbols[1]->value});
 }
 
 Syntax::SymbolPtr SyntaxZyl::reduce_declaration_array(const std::vector<SymbolPtr> &symbols) {
@@ -431,7 +494,7 @@ Syntax::SymbolPtr SyntaxZyl::reduce_declaration_array(const std::vector<SymbolPt
   //      0 1 2 3 4
   TablePtr symbol_table = stack_symbol_table_.top();
   ArrEntryPtr entry = std::make_shared<ArrayEntry>();
-  TPtr symbol_t = std::dynamic_pointer_cast<SymbolT>(symbols[0]);
+  TPtr symbol_t = as<SymbolT>(symbols[0]);
   int array_length = std::stoi(symbols[3]->value);
 
   entry->name = symbols[1]->value;
@@ -445,8 +508,7 @@ Syntax::SymbolPtr SyntaxZyl::reduce_declaration_array(const std::vector<SymbolPt
 
   entry->base = symbol_table->width;
 
-  SymbolD symbol_d = SymbolD("D", "D", {symbols[1]->value});
-  return std::make_shared<SymbolD>(symbol_d);
+  return make<SymbolD>("D", "D", std::vector<std::string>{symbols[1]->value});
 }
 
 Syntax::SymbolPtr SyntaxZyl::reduce_declaration_func(const std::vector<SymbolPtr> &symbols) {
@@ -457,16 +519,16 @@ Syntax::SymbolPtr SyntaxZyl::reduce_declaration_func(const std::vector<SymbolPtr
   TablePtr outer = stack_symbol_table_.top();
 
   // 创建新的符号表
-  SListPtr symbol_sc = std::dynamic_pointer_cast<SymbolSList>(symbols[7]);
+  SListPtr symbol_sc = as<SymbolSList>(symbols[7]);
   symbol_table->name = symbols[1]->value;
   symbol_table->outer = outer;
   symbol_table->level = outer->level + 1;
-  symbol_table->code = symbol_sc->code;
+  symbol_table->code = symbol_sc->code.instructions();
   map_symbol_table_[get_table_name(*symbol_table)] = symbol_table;
 
   // 创建函数登记项
   FunEntryPtr entry = std::make_shared<FunEntry>();
-  TPtr symbol_t = std::dynamic_pointer_cast<SymbolT>(symbols[0]);
+  TPtr symbol_t = as<SymbolT>(symbols[0]);
 
   entry->name = symbols[1]->value;
   entry->type = "func";
@@ -479,8 +541,7 @@ Syntax::SymbolPtr SyntaxZyl::reduce_declaration_func(const std::vector<SymbolPtr
 
   symbol_table->rtype = symbol_t->type;
 
-  SymbolD symbol_d = SymbolD("D", "D", {symbols[1]->value});
-  return std::make_shared<SymbolD>(symbol_d);
+  return make<SymbolD>("D", "D", std::vector<std::string>{symbols[1]->value});
 }
 
 Syntax::SymbolPtr SyntaxZyl::reduce_type(const std::vector<SymbolPtr> &symbols) {
@@ -488,8 +549,7 @@ Syntax::SymbolPtr SyntaxZyl::reduce_type(const std::vector<SymbolPtr> &symbols)
   // T -> int
   // T -> void
   // T -> float
-  SymbolT symbol_t = SymbolT("T", "T", symbols[0]->value);
-  return std::make_shared<SymbolT>(symbol_t);
+  return make<SymbolT>("T", "T", symbols[0]->value);
 }
 
 Syntax::SymbolPtr SyntaxZyl::reduce_params(const std::vector<SymbolPtr> &symbols) {
@@ -501,21 +561,19 @@ Syntax::SymbolPtr SyntaxZyl::reduce_params(const std::vector<SymbolPtr> &symbols
   table->outer = outer;
   stack_symbol_table_.push(table);
 
-  SymbolAList symbol_a = SymbolAList("A'", "A'", {});
-  return std::make_shared<SymbolAList>(symbol_a);
+  return make<SymbolAList>("A'", "A'", std::vector<std::string>{});
 }
 
 Syntax::SymbolPtr SyntaxZyl::reduce_params_list(const std::vector<SymbolPtr> &symbols) {
   // 文法 10
   // A' -> A' A ;
   //       0  1 2
-  AListPtr symbol_ac = std::dynamic_pointer_cast<SymbolAList>(symbols[0]);
-  APtr symbol_a = std::dynamic_pointer_cast<SymbolA>(symbols[1]);
+  AListPtr symbol_ac = as<SymbolAList>(symbols[0]);
+  APtr symbol_a = as<SymbolA>(symbols[1]);
   // 将两个place连起来
   std::vector<std::string> new_place = symbol_a->place;
   new_place.insert(new_place.end(), symbol_ac->place.begin(), symbol_ac->place.end());
-  SymbolAList symbol_ac_new = SymbolAList("A'", "A'", new_place);
-  return std::make_shared<SymbolAList>(symbol_ac_new);
+  return make<SymbolAList>("A'", "A'", std::move(new_place));
 }
 
 Syntax::SymbolPtr SyntaxZyl::reduce_param_var(const std::vector<SymbolPtr> &symbols) {
@@ -524,7 +582,7 @@ Syntax::SymbolPtr SyntaxZyl::reduce_param_var(const std::vector<SymbolPtr> &symb
   //      0 1
   TablePtr symbol_table = stack_symbol_table_.top();
   EntryPtr entry = std::make_shared<Entry>();
-  TPtr symbol_t = std::dynamic_pointer_cast<SymbolT>(symbols[0]);
+  TPtr symbol_t = as<SymbolT>(symbols[0]);
 
   entry->name = symbols[1]->value;
   entry->type = symbol_t->type;
@@ -536,8 +594,7 @@ Syntax::SymbolPtr SyntaxZyl::reduce_param_var(const std::vector<SymbolPtr> &symb
 
   entry->offset = symbol_table->width;
 
-  SymbolA symbol_a = SymbolA("A", "A", {symbols[1]->value});
-  return std::make_shared<SymbolA>(symbol_a);
+  return make<SymbolA>("A", "A", std::vector<std::string>{symbols[1]->value});
 }
 
 Syntax::SymbolPtr SyntaxZyl::reduce_param_array(const std::vector<SymbolPtr> &symbols) {
@@ -546,7 +603,7 @@ Syntax::SymbolPtr SyntaxZyl::reduce_param_array(const std::vector<SymbolPtr> &sy
   //      0 1 2 3
   TablePtr symbol_table = stack_symbol_table_.top();
   ArrPttEntryPtr entry = std::make_shared<ArrPttEntry>();
-  TPtr symbol_t = std::dynamic_pointer_cast<SymbolT>(symbols[0]);
+  TPtr symbol_t = as<SymbolT>(symbols[0]);
 
   entry->name = symbols[1]->value;
   entry->type = "arrptt";
@@ -559,8 +616,7 @@ Syntax::SymbolPtr SyntaxZyl::reduce_param_array(const std::vector<SymbolPtr> &sy
 
   entry->base = symbol_table->width;
 
-  SymbolA symbol_a = SymbolA("A", "A", {symbols[1]->value});
-  return std::make_shared<SymbolA>(symbol_a);
+  return make<SymbolA>("A", "A", std::vector<std::string>{symbols[1]->value});
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_param_func(const std::vector<SymbolPtr> &symbols) {
@@ -569,7 +625,7 @@ SyntaxZyl::SymbolPtr SyntaxZyl::reduce_param_func(const std::vector<SymbolPtr> &
   //      0 1 2 3
   TablePtr symbol_table = stack_symbol_table_.top();
   FunPttEntryPtr entry = std::make_shared<FunPttEntry>();
-  TPtr symbol_t = std::dynamic_pointer_cast<SymbolT>(symbols[0]);
+  TPtr symbol_t = as<SymbolT>(symbols[0]);
 
   entry->name = symbols[1]->value;
   entry->type = "funptt";
@@ -582,30 +638,26 @@ SyntaxZyl::SymbolPtr SyntaxZyl::reduce_param_func(const std::vector<SymbolPtr> &
 
   entry->offset = symbol_table->width;
 
-  SymbolA symbol_a = SymbolA("A", "A", {symbols[1]->value});
-  return std::make_shared<SymbolA>(symbol_a);
+  return make<SymbolA>("A", "A", std::vector<std::string>{symbols[1]->value});
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_sentences(const std::vector<SymbolPtr> &symbols) {
   // 文法 14
   // S' -> S
   //       0
-  SPtr symbol_s = std::dynamic_pointer_cast<SymbolS>(symbols[0]);
-  SymbolSList symbol_sc = SymbolSList("S'", "S'", {symbol_s->code});
-  return std::make_shared<SymbolSList>(symbol_sc);
+  SPtr symbol_s = as<SymbolS>(symbols[0]);
+  return make<SymbolSList>("S'", "S'", symbol_s->code);
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_sentences_list(const std::vector<SymbolPtr> &symbols) {
   // 文法 15
   // S' -> S' ; S
   //       0  1 2
-  SListPtr symbol_sc = std::dynamic_pointer_cast<SymbolSList>(symbols[0]);
-  SPtr symbol_s = std::dynamic_pointer_cast<SymbolS>(symbols[2]);
+  SListPtr symbol_sc = as<SymbolSList>(symbols[0]);
+  SPtr symbol_s = as<SymbolS>(symbols[2]);
 
-  std::vector<std::string> new_code = symbol_sc->code;
-  new_code.push_back(symbol_s->code);
-  SymbolSList symbol_sc_new = SymbolSList("S'", "S'", new_code);
-  return std::make_shared<SymbolSList>(symbol_sc_new);
+  CodeRope new_code = symbol_sc->code + symbol_s->code;
+  return make<SymbolSList>("S'", "S'", std::move(new_code));
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_sentence_assign(const std::vector<SymbolPtr> &symbols) {
@@ -613,28 +665,26 @@ SyntaxZyl::SymbolPtr SyntaxZyl::reduce_sentence_assign(const std::vector<SymbolP
   // S -> d = E
   //      0 1 2
   std::string var_name = symbols[0]->value;
-  EPtr symbol_e = std::dynamic_pointer_cast<SymbolE>(symbols[2]);
+  EPtr symbol_e = as<SymbolE>(symbols[2]);
 
-  std::string code = symbol_e->code;
-  code += var_name + " = " + symbol_e->place + ";\n";
-  SymbolS symbol_s = SymbolS("S", "S", code);
-  return std::make_shared<SymbolS>(symbol_s);
+  CodeRope code = symbol_e->code;
+  code += TacInstruction::assign(TacOperand::variable(var_name), symbol_e->place);
+  return make<SymbolS>("S", "S", std::move(code));
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_sentence_if(const std::vector<SymbolPtr> &symbols) {
   // 文法 17
   // S -> if ( B ) S
   //      0  1 2 3 4
-  BPtr symbol_b = std::dynamic_pointer_cast<SymbolB>(symbols[2]);
-  SPtr symbol_s = std::dynamic_pointer_cast<SymbolS>(symbols[4]);
+  BPtr symbol_b = as<SymbolB>(symbols[2]);
+  SPtr symbol_s = as<SymbolS>(symbols[4]);
 
-  std::string code = symbol_b->code;
-  code += gen_code("LABEL", symbol_b->tc);
+  CodeRope code = symbol_b->code;
+  code += gen_labels(symbol_b->tc);
   code += symbol_s->code;
-  code += gen_code("LABEL", symbol_b->fc);
+  code += gen_labels(symbol_b->fc);
 
-  SymbolS symbol_s_new = SymbolS("S", "S", code);
-  return std::make_shared<SymbolS>(symbol_s_new);
+  return make<SymbolS>("S", "S", std::move(code));
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_sentence_if_else(const std::vector<SymbolPtr> &symbols) {
@@ -642,20 +692,19 @@ SyntaxZyl::SymbolPtr SyntaxZyl::reduce_sentence_if_else(const std::vector<Symbol
   // S -> if ( B ) S else S
   //      0  1 2 3 4 5    6
   std::string label = new_label();
-  BPtr symbol_b = std::dynamic_pointer_cast<SymbolB>(symbols[2]);
-  SPtr symbol_s1 = std::dynamic_pointer_cast<SymbolS>(symbols[4]);
-  SPtr symbol_s2 = std::dynamic_pointer_cast<SymbolS>(symbols[6]);
+  BPtr symbol_b = as<SymbolB>(symbols[2]);
+  SPtr symbol_s1 = as<SymbolS>(symbols[4]);
+  SPtr symbol_s2 = as<SymbolS>(symbols[6]);
 
-  std::string code = symbol_b->code;
-  code += gen_code("LABEL", symbol_b->tc);
+  CodeRope code = symbol_b->code;
+  code += gen_labels(symbol_b->tc);
   code += symbol_s1->code;
-  code += gen_code("GOTO", label);
-  code += gen_code("LABEL", symbol_b->fc);
+  code += gen_goto(label);
+  code += gen_labels(symbol_b->fc);
   code += symbol_s2->code;
-  code += gen_code("LABEL", label);
+  code += gen_label(label);
 
-  SymbolS symbol_s_new = SymbolS("S", "S", code);
-  return std::make_shared<SymbolS>(symbol_s_new);
+  return make<SymbolS>("S", "S", std::move(code));
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_sentence_while(const std::vector<SymbolPtr> &symbols) {
@@ -663,41 +712,38 @@ SyntaxZyl::SymbolPtr SyntaxZyl::reduce_sentence_while(const std::vector<SymbolPt
   // S -> while ( B ) S
   //      0     1 2 3 4
   std::string label = new_label();
-  BPtr symbol_b = std::dynamic_pointer_cast<SymbolB>(symbols[2]);
-  SPtr symbol_s = std::dynamic_pointer_cast<SymbolS>(symbols[4]);
+  BPtr symbol_b = as<SymbolB>(symbols[2]);
+  SPtr symbol_s = as<SymbolS>(symbols[4]);
 
-  std::string code = gen_code("LABEL", {label});
+  CodeRope code = gen_label(label);
   code += symbol_b->code;
-  code += gen_code("LABEL", symbol_b->tc);
+  code += gen_labels(symbol_b->tc);
   code += symbol_s->code;
-  code += gen_code("GOTO", label);
-  code += gen_code("LABEL", symbol_b->fc);
+  code += gen_goto(label);
+  code += gen_labels(symbol_b->fc);
 
-  SymbolS symbol_s_new = SymbolS("S", "S", code);
-  return std::make_shared<SymbolS>(symbol_s_new);
+  return make<SymbolS>("S", "S", std::move(code));
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_sentence_return(const std::vector<SymbolPtr> &symbols) {
   // 文法 20
   // S -> return E
   //      0      1
-  EPtr symbol_e = std::dynamic_pointer_cast<SymbolE>(symbols[1]);
+  EPtr symbol_e = as<SymbolE>(symbols[1]);
 
-  std::string code = symbol_e->code;
-  code += gen_code("RETURN", symbol_e->place);
+  CodeRope code = symbol_e->code;
+  code += TacInstruction::ret(symbol_e->place);
 
-  SymbolS symbol_s = SymbolS("S", "S", code);
-  return std::make_shared<SymbolS>(symbol_s);
+  return make<SymbolS>("S", "S", std::move(code));
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_sentence_block(const std::vector<SymbolPtr> &symbols) {
   // 文法 21
   // S -> { S' }
   //      0 1  2
-  SListPtr symbol_sc = std::dynamic_pointer_cast<SymbolSList>(symbols[1]);
+  SListPtr symbol_sc = as<SymbolSList>(symbols[1]);
 
-  SymbolS symbol_s = SymbolS("S", "S", merge_code(symbol_sc->code));
-  return std::make_shared<SymbolS>(symbol_s);
+  return make<SymbolS>("S", "S", symbol_sc->code);
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_sentence_call(const std::vector<SymbolPtr> &symbols) {
@@ -706,7 +752,7 @@ SyntaxZyl::SymbolPtr SyntaxZyl::reduce_sentence_call(const std::vector<SymbolPtr
   //      0 1 2  3
   std::string d = symbols[0]->value;
   TablePtr table = stack_symbol_table_.top();
-  RListPtr rlist = std::dynamic_pointer_cast<SymbolRList>(symbols[2]);
+  RListPtr rlist = as<SymbolRList>(symbols[2]);
 
   EntryPtr entry = table->lookup_entry(d);
   if (!entry) {
@@ -720,51 +766,46 @@ SyntaxZyl::SymbolPtr SyntaxZyl::reduce_sentence_call(const std::vector<SymbolPtr
     return nullptr;
   }
 
-  std::string var = new_var();
-  std::string code = new_params(rlist->place);
-  code += var + " = " + "CALL " + d + ", " + std::to_string(rlist->place.size()) + ";\n";
-
-  std::string s_code = merge_code(rlist->code);
-  s_code += code;
+  TacOperand var = new_var();
+  CodeRope s_code = rlist->code;
+  s_code += new_params(rlist->place);
+  s_code += TacInstruction::call(std::move(var), TacOperand::function(d), static_cast<int>(rlist->place.size()));
 
-  SymbolS s = SymbolS("S", "S", s_code);
-  return std::make_shared<SymbolS>(s);
+  return make<SymbolS>("S", "S", std::move(s_code));
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_bool_and(const std::vector<SymbolPtr> &symbols) {
   // 文法 23
   // B -> B ∧ B
   //      0 1 2
-  BPtr symbol_b1 = std::dynamic_pointer_cast<SymbolB>(symbols[0]);
-  BPtr symbol_b2 = std::dynamic_pointer_cast<SymbolB>(symbols[2]);
+  BPtr symbol_b1 = as<SymbolB>(symbols[0]);
+  BPtr symbol_b2 = as<SymbolB>(symbols[2]);
 
   std::vector<std::string> tc = symbol_b2->tc;
   std::vector<std::string> fc = merge_list(symbol_b1->fc, symbol_b2->fc);
 
-  std::string code = symbol_b1->code;
-  code += gen_code("LABEL", symbol_b1->tc);
+  CodeRope code = symbol_b1->code;
+  code += gen_labels(symbol_b1->tc);
   code += symbol_b2->code;
 
-  SymbolB symbol_b = SymbolB("B", "B", tc, fc, code);
-  return std::make_shared<SymbolB>(symbol_b);
+  return make<SymbolB>("B", "B", std::move(tc), std::move(fc), std::move(code));
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_bool_or(const std::vector<SymbolPtr> &symbols) {
   // 文法 24
   // B -> B ∨ B
   //      0 1 2
-  BPtr symbol_b1 = std::dynamic_pointer_cast<SymbolB>(symbols[0]);
-  BPtr symbol_b2 = std::dynamic_pointer_cast<SymbolB>(symbols[2]);
+  BPtr symbol_b1 = as<SymbolB>(symbols[0]);
+  BPtr symbol_b2 = as<SymbolB>(symbols[2]);
 
   std::vector<std::string> tc = merge_list(symbol_b1->tc, symbol_b2->tc);
   std::vector<std::string> fc = symbol_b2->fc;
 
-  std::string code = symbol_b1->code;
-  code += gen_code("LABEL", symbol_b1->fc);
+  CodeRope code = symbol_b1->code;
+  code += gen_labels(symbol_b1->fc);
   code += symbol_b2->code;
 
-  SymbolB symbol_b = SymbolB("B", "B", tc, fc, code);
-  return std::make_shared<SymbolB>(symbol_b);
+  return make<SymbolB>("B", "B", std::move(tc), std::move(fc), std::move(code));
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_bool_relation(const std::vector<SymbolPtr> &symbols) {
@@ -773,17 +814,16 @@ SyntaxZyl::SymbolPtr SyntaxZyl::reduce_bool_relation(const std::vector<SymbolPtr
   //      0 1 2
   std::string label1 = new_label();
   std::string label2 = new_label();
-  EPtr symbol_e1 = std::dynamic_pointer_cast<SymbolE>(symbols[0]);
-  EPtr symbol_e2 = std::dynamic_pointer_cast<SymbolE>(symbols[2]);
+  EPtr symbol_e1 = as<SymbolE>(symbols[0]);
+  EPtr symbol_e2 = as<SymbolE>(symbols[2]);
 
   std::vector<std::string> tc = { label1 };
   std::vector<std::string> fc = { label2 };
-  std::string code = symbol_e1->code + symbol_e2->code;
-  code += "IF " + symbol_e1->place + " " + symbols[1]->value + " " + symbol_e2->place + " ";
-  code += "THEN " + label1 + " ELSE " + label2 + ";\n";
+  CodeRope code = symbol_e1->code + symbol_e2->code;
+  code += TacInstruction::branch(symbol_e1->place, symbols[1]->value, symbol_e2->place,
+                                 TacOperand::label(label1), TacOperand::label(label2));
 
-  SymbolB symbol_b = SymbolB("B", "B", tc, fc, code);
-  return std::make_shared<SymbolB>(symbol_b);
+  return make<SymbolB>("B", "B", std::move(tc), std::move(fc), std::move(code));
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_bool_expr(const std::vector<SymbolPtr> &symbols) {
@@ -792,43 +832,40 @@ SyntaxZyl::SymbolPtr SyntaxZyl::reduce_bool_expr(const std::vector<SymbolPtr> &s
   //      0
   std::string label1 = new_label();
   std::string label2 = new_label();
-  EPtr symbol_e = std::dynamic_pointer_cast<SymbolE>(symbols[0]);
+  EPtr symbol_e = as<SymbolE>(symbols[0]);
 
   std::vector<std::string> tc = { label1 };
   std::vector<std::string> fc = { label2 };
-  std::string code = symbol_e->code;
-  code += "IF " + symbol_e->place + " != 0 ";
-  code += "THEN " + label1 + " ELSE " + label2 + ";\n";
+  CodeRope code = symbol_e->code;
+  code += TacInstruction::branch(symbol_e->place, "!=", TacOperand::constant("0"),
+                                 TacOperand::label(label1), TacOperand::label(label2));
 
-  SymbolB symbol_b = SymbolB("B", "B", tc, fc, code);
-  return std::make_shared<SymbolB>(symbol_b);
+  return make<SymbolB>("B", "B", std::move(tc), std::move(fc), std::move(code));
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_expr_assgin(const std::vector<SymbolPtr> &symbols) {
   // 文法 27
   // E -> d = E
   //      0 1 2
-  std::string var = symbols[0]->value;
-  EPtr e = std::dynamic_pointer_cast<SymbolE>(symbols[2]);
+  TacOperand var = TacOperand::variable(symbols[0]->value);
+  EPtr e = as<SymbolE>(symbols[2]);
 
   // code 域
-  std::string code = e->code;
-  code += var + " = " + e->place + ";\n";
+  CodeRope code = e->code;
+  code += TacInstruction::assign(var, e->place);
 
-  SymbolE e_new = SymbolE("E", "E", var, code, e->type, e->num);
-  return std::make_shared<SymbolE>(e_new);
+  return make<SymbolE>("E", "E", std::move(var), std::move(code), e->type, e->num);
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_expr_num_int(const std::vector<SymbolPtr> &syms) {
   // 文法 28
   // E -> i
   //      0
-  std::string var = new_var();
+  TacOperand var = new_var();
 
-  std::string code = var + " = " + syms[0]->value + ";\n";
+  CodeRope code = TacInstruction::assign(var, TacOperand::constant(syms[0]->value));
 
-  SymbolE e = SymbolE("E", "E", var, code, "int", syms[0]->value);
-  return std::make_shared<SymbolE>(e);
+  return make<SymbolE>("E", "E", std::move(var), std::move(code), "int", syms[0]->value);
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_expr_var(const std::vector<SymbolPtr> &symbols) {
@@ -844,8 +881,7 @@ SyntaxZyl::SymbolPtr SyntaxZyl::reduce_expr_var(const std::vector<SymbolPtr> &sy
     return nullptr;
   }
 
-  SymbolE symbol_e = SymbolE("E", "E", var_name, "", entry->type, "");
-  return std::make_shared<SymbolE>(symbol_e);
+  return make<SymbolE>("E", "E", TacOperand::variable(std::move(var_name)), CodeRope(), entry->type, "");
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_expr_call(const std::vector<SymbolPtr> &syms) {
@@ -854,14 +890,12 @@ SyntaxZyl::SymbolPtr SyntaxZyl::reduce_expr_call(const std::vector<SymbolPtr> &s
   //      0 1 2  3
   std::string d = syms[0]->value;
   TablePtr symbol_table = stack_symbol_table_.top();
-  RListPtr rlist = std::dynamic_pointer_cast<SymbolRList>(syms[2]);
+  RListPtr rlist = as<SymbolRList>(syms[2]);
 
-  std::string var = new_var();
-  std::string code = new_params(rlist->place);
-  code += var + " = " + "CALL " + d + ", " + std::to_string(rlist->place.size()) + ";\n";
-
-  std::string e_code = merge_code(rlist->code);
-  e_code += code;
+  TacOperand var = new_var();
+  CodeRope e_code = rlist->code;
+  e_code += new_params(rlist->place);
+  e_code += TacInstruction::call(var, TacOperand::function(d), static_cast<int>(rlist->place.size()));
 
   EntryPtr entry = symbol_table->lookup_entry(d);
   if (!entry) {
@@ -890,8 +924,7 @@ SyntaxZyl::SymbolPtr SyntaxZyl::reduce_expr_call(const std::vector<SymbolPtr> &s
     rtype = func_entry->rtype;
   }
 
-  SymbolE e = SymbolE("E", "E", var, e_code, rtype, "");
-  return std::make_shared<SymbolE>(e);
+  return make<SymbolE>("E", "E", std::move(var), std::move(e_code), std::move(rtype), "");
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_expr_operator(const std::vector<SymbolPtr> &syms) {
@@ -900,13 +933,13 @@ SyntaxZyl::SymbolPtr SyntaxZyl::reduce_expr_operator(const std::vector<SymbolPtr
   // E -> E * E
   // E -> E - E
   // E -> E / E
-  std::string var = new_var();
+  TacOperand var = new_var();
   std::string op = syms[1]->value;
-  EPtr e1 = std::dynamic_pointer_cast<SymbolE>(syms[0]);
-  EPtr e2 = std::dynamic_pointer_cast<SymbolE>(syms[2]);
+  EPtr e1 = as<SymbolE>(syms[0]);
+  EPtr e2 = as<SymbolE>(syms[2]);
 
-  std::string code = e1->code + e2->code;
-  code += var + " = " + e1->place + " " + op + " " + e2->place + ";\n";
+  CodeRope code = e1->code + e2->code;
+  code += TacInstruction::binary(var, e1->place, op, e2->place);
 
   // if (e1->type != e2->type) {
   //   throw std::runtime_error("类型不匹配" + e1->type + syms[1]->value + e2->type);
@@ -914,52 +947,46 @@ SyntaxZyl::SymbolPtr SyntaxZyl::reduce_expr_operator(const std::vector<SymbolPtr
 
   std::string num = compute_const_number(e1, e2, op);
 
-  SymbolE e = SymbolE("E", "E", var, code, e1->type, num);
-  return std::make_shared<SymbolE>(e);
+  return make<SymbolE>("E", "E", std::move(var), std::move(code), e1->type, std::move(num));
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_expr_bracket(const std::vector<SymbolPtr> &syms) {
   // 文法 33
   // E -> ( E )
   //      0 1 2
-  EPtr e = std::dynamic_pointer_cast<SymbolE>(syms[1]);
+  EPtr e = as<SymbolE>(syms[1]);
 
-  SymbolE e_new = SymbolE("E", "E", e->place, e->code, e->type, e->num);
-  return std::make_shared<SymbolE>(e_new);
+  return make<SymbolE>("E", "E", e->place, e->code, e->type, e->num);
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_call_params(const std::vector<SymbolPtr> &symbols) {
   // 文法 34
   // R' -> ε
   //       0
-  SymbolRList symbol_rc = SymbolRList("R'", "R'", {}, {});
-  return std::make_shared<SymbolRList>(symbol_rc);
+  return make<SymbolRList>("R'", "R'", std::vector<TacOperand>{}, CodeRope());
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_call_params_list(const std::vector<SymbolPtr> &symbols) {
   // 文法 35
   // R' -> R' R ,
   //       0  1 2
-  RListPtr symbol_rc = std::dynamic_pointer_cast<SymbolRList>(symbols[0]);
-  RPtr symbol_r = std::dynamic_pointer_cast<SymbolR>(symbols[1]);
+  RListPtr symbol_rc = as<SymbolRList>(symbols[0]);
+  RPtr symbol_r = as<SymbolR>(symbols[1]);
 
-  std::vector<std::string> place = symbol_rc->place;
+  std::vector<TacOperand> place = symbol_rc->place;
   place.push_back(symbol_r->place);
 
-  std::vector<std::string> code = symbol_rc->code;
-  code.push_back(symbol_r->code);
+  CodeRope code = symbol_rc->code + symbol_r->code;
 
-  SymbolRList symbol_rc_new = SymbolRList("R'", "R'", place, code);
-  return std::make_shared<SymbolRList>(symbol_rc_new);
+  return make<SymbolRList>("R'", "R'", std::move(place), std::move(code));
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_call_param_expr(const std::vector<SymbolPtr> &symbols) {
   // 文法 36
   // R -> E
   //      0
-  EPtr symbol_e = std::dynamic_pointer_cast<SymbolE>(symbols[0]);
-  SymbolR symbol_r = SymbolR("R", "R", symbol_e->place, symbol_e->code);
-  return std::make_shared<SymbolR>(symbol_r);
+  EPtr symbol_e = as<SymbolE>(symbols[0]);
+  return make<SymbolR>("R", "R", symbol_e->place, symbol_e->code);
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_call_param_array(const std::vector<SymbolPtr> &symbols) {
@@ -967,8 +994,7 @@ SyntaxZyl::SymbolPtr SyntaxZyl::reduce_call_param_array(const std::vector<Symbol
   // R -> d [ ]
   //      0 1 2
   std::string var_name = symbols[0]->value;
-  SymbolR symbol_r = SymbolR("R", "R", var_name, "");
-  return std::make_shared<SymbolR>(symbol_r);
+  return make<SymbolR>("R", "R", TacOperand::variable(std::move(var_name)), CodeRope());
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_call_param_func(const std::vector<SymbolPtr> &symbols) {
@@ -976,8 +1002,7 @@ SyntaxZyl::SymbolPtr SyntaxZyl::reduce_call_param_func(const std::vector<SymbolP
   // R -> d ( )
   //      0 1 2
   std::string var_name = symbols[0]->value;
-  SymbolR symbol_r = SymbolR("R", "R", var_name, "");
-  return std::make_shared<SymbolR>(symbol_r);
+  return make<SymbolR>("R", "R", TacOperand::function(std::move(var_name)), CodeRope());
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_sentence_array_assgin(const std::vector<SymbolPtr> &syms) {
@@ -986,8 +1011,8 @@ SyntaxZyl::SymbolPtr SyntaxZyl::reduce_sentence_array_assgin(const std::vector<S
   //      0 1 2 3 4 5
   std::string d = syms[0]->value;
   TablePtr symbol_table = stack_symbol_table_.top();
-  EPtr e1 = std::dynamic_pointer_cast<SymbolE>(syms[2]);
-  EPtr e2 = std::dynamic_pointer_cast<SymbolE>(syms[5]);
+  EPtr e1 = as<SymbolE>(syms[2]);
+  EPtr e2 = as<SymbolE>(syms[5]);
 
   EntryPtr entry = symbol_table->lookup_entry(d);
   if (!entry) {
@@ -1017,10 +1042,10 @@ SyntaxZyl::SymbolPtr SyntaxZyl::reduce_sentence_array_assgin(const std::vector<S
     }
   }
 
-  std::string code = e1->code + e2->code;
-  code += d + "[" + e1->place + "] = " + e2->place + ";\n";
+  CodeRope code = e1->code + e2->code;
+  code += TacInstruction::store_array(TacOperand::variable(d), e1->place, e2->place);
 
-  SPtr s = std::make_shared<SymbolS>("S", "S", code);
+  SPtr s = make<SymbolS>("S", "S", std::move(code));
   return s;
 }
 
@@ -1029,35 +1054,33 @@ SyntaxZyl::SymbolPtr SyntaxZyl::reduce_sentence_for(const std::vector<SymbolPtr>
   // S -> for ( S ; B ; S ) S
   //      0   1 2 3 4 5 6 7 8
   std::string label = new_label();
-  SPtr s1 = std::dynamic_pointer_cast<SymbolS>(syms[2]);
-  BPtr b = std::dynamic_pointer_cast<SymbolB>(syms[4]);
-  SPtr s2 = std::dynamic_pointer_cast<SymbolS>(syms[6]);
-  SPtr s3 = std::dynamic_pointer_cast<SymbolS>(syms[8]);
+  SPtr s1 = as<SymbolS>(syms[2]);
+  BPtr b = as<SymbolB>(syms[4]);
+  SPtr s2 = as<SymbolS>(syms[6]);
+  SPtr s3 = as<SymbolS>(syms[8]);
 
-  std::string code = s1->code;
-  code += gen_code("LABEL", {label});
+  CodeRope code = s1->code;
+  code += gen_label(label);
   code += b->code;
-  code += gen_code("LABEL", b->tc);
+  code += gen_labels(b->tc);
   code += s3->code;
   code += s2->code;
-  code += gen_code("GOTO", label);
-  code += gen_code("LABEL", b->fc);
+  code += gen_goto(label);
+  code += gen_labels(b->fc);
 
-  SymbolS symbol_s = SymbolS("S", "S", code);
-  return std::make_shared<SymbolS>(symbol_s);
+  return make<SymbolS>("S", "S", std::move(code));
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_sentence_print(const std::vector<SymbolPtr> &syms) {
   // 文法 42
   // S -> print E
   //      0     1
-  EPtr e = std::dynamic_pointer_cast<SymbolE>(syms[1]);
+  EPtr e = as<SymbolE>(syms[1]);
 
-  std::string code = e->code;
-  code += gen_code("PRINT", e->place);
+  CodeRope code = e->code;
+  code += TacInstruction::print(e->place);
 
-  SymbolS symbol_s = SymbolS("S", "S", code);
-  return std::make_shared<SymbolS>(symbol_s);
+  return make<SymbolS>("S", "S", std::move(code));
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_sentence_input(const std::vector<SymbolPtr> &syms) {
@@ -1067,21 +1090,19 @@ SyntaxZyl::SymbolPtr SyntaxZyl::reduce_sentence_input(const std::vector<SymbolPt
   std::string d = syms[1]->value;
   EntryPtr entry = check_var(d);
 
-  std::string code = gen_code("INPUT", d);
+  CodeRope code = TacInstruction::input(TacOperand::variable(d));
 
-  SymbolS symbol_s = SymbolS("S", "S", code);
-  return std::make_shared<SymbolS>(symbol_s);
+  return make<SymbolS>("S", "S", std::move(code));
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_expr_num_float(const std::vector<SymbolPtr> &syms) {
   // 文法 44
   // E -> f
   //      0
-  std::string var = new_var();
-  std::string code = var + " = " + syms[0]->value + ";\n";
+  TacOperand var = new_var();
+  CodeRope code = TacInstruction::assign(var, TacOperand::constant(syms[0]->value));
 
-  SymbolE e = SymbolE("E", "E", var, code, "float", syms[0]->value);
-  return std::make_shared<SymbolE>(e);
+  return make<SymbolE>("E", "E", std::move(var), std::move(code), "float", syms[0]->value);
 }
 
 SyntaxZyl::SymbolPtr SyntaxZyl::reduce_expr_array(const std::vector<SymbolPtr> &syms) {
@@ -1089,9 +1110,9 @@ SyntaxZyl::SymbolPtr SyntaxZyl::reduce_expr_array(const std::vector<SymbolPtr> &
   // E -> d [ E ]
   //      0 1 2 3
   std::string d = syms[0]->value;
-  std::string var = new_var();
+  TacOperand var = new_var();
   TablePtr symbol_table = stack_symbol_table_.top();
-  EPtr e = std::dynamic_pointer_cast<SymbolE>(syms[2]);
+  EPtr e = as<SymbolE>(syms[2]);
 
   EntryPtr entry = symbol_table->lookup_entry(d);
   if (!entry) {
@@ -1130,31 +1151,34 @@ SyntaxZyl::SymbolPtr SyntaxZyl::reduce_expr_array(const std::vector<SymbolPtr> &
 
 
 
-  std::string code = e->code;
-  code += var + " = " + d + "[" + e->place + "];\n";
+  CodeRope code = e->code;
+  code += TacInstruction::load_array(var, TacOperand::variable(d), e->place);
 
-  SymbolE symbol_e = SymbolE("E", "E", var, code, etype, "");
-  return std::make_shared<SymbolE>(symbol_e);
+  return make<SymbolE>("E", "E", std::move(var), std::move(code), std::move(etype), "");
 }
 
-std::string SyntaxZyl::new_var() {
-  return "t" + std::to_string(variable_count_++);
+TacOperand SyntaxZyl::new_var() {
+  return TacOperand::temp("t" + std::to_string(variable_count_++));
 }
 
 std::string SyntaxZyl::new_label() {
   return "l" + std::to_string(label_count_++);
 }
 
-std::string SyntaxZyl::gen_code(const std::string &instruction, const std::string &label) {
-  return instruction + " " + label + ";\n";
+CodeRope SyntaxZyl::gen_label(const std::string &label) {
+  return TacInstruction::label(TacOperand::label(label));
 }
 
-std::string SyntaxZyl::gen_code(const std::string& instruction, const std::vector<std::string> &labels) {\
-  std::ostringstream oss;
+CodeRope SyntaxZyl::gen_labels(const std::vector<std::string> &labels) {
+  CodeRope code;
   for (const auto &label : labels) {
-    oss << instruction << " " << label << ";\n";
+    code += gen_label(label);
   }
-  return oss.str();
+  return code;
+}
+
+CodeRope SyntaxZyl::gen_goto(const std::string &label) {
+  return TacInstruction::jump(TacOperand::label(label));
 }
 
 std::string SyntaxZyl::new_labels(const std::vector<std::string> &labels) {
@@ -1165,12 +1189,12 @@ std::string SyntaxZyl::new_labels(const std::vector<std::string> &labels) {
   return oss.str();
 }
 
-std::string SyntaxZyl::new_params(const std::vector<std::string> &parlist) {
-  std::ostringstream oss;
+CodeRope SyntaxZyl::new_params(const std::vector<TacOperand> &parlist) {
+  CodeRope code;
   for (auto it = parlist.rbegin(); it != parlist.rend(); ++it) {
-    oss << "PAR " << *it << ";\n";
+    code += TacInstruction::param(*it);
   }
-  return oss.str();
+  return code;
 }
 
 SyntaxZyl::EntryPtr SyntaxZyl::check_var(std::string d) {
@@ -1189,16 +1213,15 @@ std::vector<std::string> SyntaxZyl::merge_list(const std::vector<std::string> &l
   return merged_list;
 }
 
-std::string SyntaxZyl::merge_code(const std::vector<std::string> &code_list) {
-  std::ostringstream oss;
-  for (const auto &code : code_list) {
-    oss << code;
-  }
-  return oss.str();
-}
-
 void SyntaxZyl::add_equation(const Grammar &grammar, AttrEqnFuncPtr handler) {
-  reduce_map_.emplace(grammar, handler);
+  // 分析表所用文法中没有这条产生式时忽略
+  const auto& grammar_to_id = slr_table_.grammar_to_id();
+  const auto it = grammar_to_id.find(grammar);
+  if (it == grammar_to_id.end() || it->second < 0) return;
+  if (static_cast<size_t>(it->second) >= reduce_handlers_.size()) {
+    reduce_handlers_.resize(it->second + 1, nullptr);
+  }
+  reduce_handlers_[it->second] = handler;
 }
 
 std::string SyntaxZyl::type_convert(const std::string &type1, const std::string &type2) {
@@ -1243,15 +1266,13 @@ std::string SyntaxZyl::compute_const_number(const EPtr &e1, EPtr &e2, const std:
 }
 
 Syntax::SymbolPtr SyntaxZyl::reduce(int grammar_id, const std::vector<SymbolPtr> &symbols) {
-  Grammar grammar = slr_table_.find_grammar(grammar_id);
-
-  auto it = reduce_map_.find(grammar);
-  if (it != reduce_map_.end()) {
-    AttrEqnFuncPtr handler = it->second;
-    return (this->*handler)(symbols);
+  const AttrEqnFuncPtr handler = grammar_id >= 0 && static_cast<size_t>(grammar_id) < reduce_handlers_.size()
+                                     ? reduce_handlers_[grammar_id] : nullptr;
+  if (!handler) {
+    std::cerr << "[Syntax] 产生式 " << grammar_id << " 没有属性方程" << std::endl;
+    return nullptr;
   }
-
-  return std::make_shared<Symbol>(grammar.lhs(), grammar.lhs());
+  return (this->*handler)(symbols);
 }
 
 std::shared_ptr<Syntax::Table> SyntaxZyl::pop_symbol_table() {
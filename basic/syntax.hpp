@@ -7,6 +7,8 @@
 #include <utility>
 #include <vector>
 
+#include "arena.hpp"
+#include "code_rope.hpp"
 #include "slr_table.hpp"
 #include "lexical.hpp"
 
@@ -60,7 +62,7 @@ public:
     std::vector<std::string> arglist; // 参数名称列表
     std::string rtype; // 返回值类型
     int level = 0; // 层级
-    std::vector<std::string> code; // 代码
+    TacCode code; // 三地址代码
     std::vector<EntryPtr> entries; // 登记项
 
     explicit Table(std::string name = "") : name(std::move(name)) {} // 构造函数
@@ -79,15 +81,21 @@ public:
   };
 
   struct Symbol {
+    // 种类：代替 dynamic_cast 判断语义值的具体类型，子类的语义值从 USER 开始编号
+    enum Kind : int { TOKEN = 0, GENERIC = 1, USER = 2 };
+
     std::string name;
     std::string value;
-    Symbol(std::string name, std::string value) : name(std::move(name)), value(std::move(value)) {}
-    Symbol(const Lexical::Token& token) : name(token.type), value(token.lexeme) {}
+    int kind;
+    Symbol(std::string name, std::string value, int kind = GENERIC)
+        : name(std::move(name)), value(std::move(value)), kind(kind) {}
+    Symbol(const Lexical::Token& token) : name(token.type), value(token.lexeme), kind(TOKEN) {}
     friend std::ostream &operator<<(std::ostream &os, const Symbol &symbol);
     virtual ~Symbol() = default;
   };
 
-  using SymbolPtr = std::shared_ptr<Symbol>;
+  // 语义值由每次分析的 Arena 持有，parse() 返回后失效
+  using SymbolPtr = Symbol*;
 
   // 构造函数：SLRTable作为语法分析器
   explicit Syntax(const SLRTable &slr_table);
@@ -97,15 +105,25 @@ public:
 
   // 解析输入字符串或文件
   bool parse(const std::vector<Lexical::Token> &tokens);
+  // tokens 由 lexical 分析得到时，按记号的类型 id 查文法符号，不再逐个按类型字符串查找
+  bool parse(const std::vector<Lexical::Token> &tokens, const Lexical &lexical);
   bool parse_file(const std::string &filename, Lexical lexical);
 
   std::unordered_map<std::string, TablePtr> symbol_table() const;
   void processes_to_txt(const std::string &filename) const;
   void symbol_table_to_txt(const std::string &filename) const;
 
+  // 是否记录分析过程（默认记录）；只要分析结果时关闭，省去每步复制记号
+  void set_record_processes(bool record) { record_processes_ = record; }
+
 protected:
   const SLRTable &slr_table_; // 引用外部的SLR表
   std::vector<Process> processes_; // 语法分析过程记录
+  bool record_processes_ = true; // 是否记录 processes_
+  std::vector<int> rhs_length_; // 产生式编号 -> 右部长度（ε 产生式为 0，编号不存在为 -1）
+  std::vector<SymbolId> lhs_id_; // 产生式编号 -> 左部符号 id
+  std::vector<SymbolPtr> reduce_args_; // 归约右部符号，各次归约复用
+  std::shared_ptr<Arena> arena_ = std::make_shared<Arena>(); // 语义值内存池，每次分析结束后 reset
   std::unordered_map<std::string, TablePtr> map_symbol_table_; // 符号表映射
   std::stack<std::shared_ptr<Table> > stack_symbol_table_; // 符号表栈
 
@@ -115,7 +133,20 @@ protected:
   friend std::ostream &operator<<(std::ostream &os, const Table &symbol_table);
   static std::string get_table_name(const Table& symbol_table);
 
-  bool analyze_tokens(const std::vector<Lexical::Token> &tokens);
+  // lexical 非空时，记号的文法符号按 lexical.symbol_ids() 由类型 id 查得
+  bool analyze_tokens(const std::vector<Lexical::Token> &tokens, const Lexical *lexical = nullptr);
+
+  // 在本次分析的内存池中构造语义值
+  template <class T, class... Args>
+  T* make(Args&&... args) {
+    return arena_->make<T>(std::forward<Args>(args)...);
+  }
+
+  // 按 kind 转换语义值的类型，种类不符时返回 nullptr
+  template <class T>
+  static T* as(SymbolPtr symbol) {
+    return symbol && symbol->kind == T::KIND ? static_cast<T*>(symbol) : nullptr;
+  }
 
   virtual bool shift(int state_id, const Lexical::Token &token) = 0;
 
@@ -125,97 +156,109 @@ protected:
 class SyntaxZyl : public Syntax {
 public:
   struct SymbolT: Symbol {
+    static constexpr int KIND = USER + 0;
     std::string type;
     SymbolT(std::string name, std::string value, std::string type)
-        : Symbol(std::move(name), std::move(value)), type(std::move(type)) {}
+        : Symbol(std::move(name), std::move(value), KIND), type(std::move(type)) {}
   };
-  using TPtr = std::shared_ptr<struct SymbolT>;
+  using TPtr = SymbolT*;
 
   struct SymbolD: Symbol {
+    static constexpr int KIND = USER + 1;
     std::vector<std::string> place;
     SymbolD(std::string name, std::string value, std::vector<std::string> place)
-        : Symbol(std::move(name), std::move(value)), place(std::move(place)) {}
+        : Symbol(std::move(name), std::move(value), KIND), place(std::move(place)) {}
   };
-  using DPtr = std::shared_ptr<struct SymbolD>;
+  using DPtr = SymbolD*;
 
   struct SymbolA: Symbol {
+    static constexpr int KIND = USER + 2;
     std::vector<std::string> place;
     SymbolA(std::string name, std::string value, std::vector<std::string> place)
-        : Symbol(std::move(name), std::move(value)), place(std::move(place)) {}
+        : Symbol(std::move(name), std::move(value), KIND), place(std::move(place)) {}
   };
-  using APtr = std::shared_ptr<struct SymbolA>;
+  using APtr = SymbolA*;
 
   struct SymbolAList: Symbol {
+    static constexpr int KIND = USER + 3;
     std::vector<std::string> place;
     SymbolAList(std::string name, std::string value, std::vector<std::string> place)
-        : Symbol(std::move(name), std::move(value)), place(std::move(place)) {}
+        : Symbol(std::move(name), std::move(value), KIND), place(std::move(place)) {}
   };
-  using AListPtr = std::shared_ptr<struct SymbolAList>;
+  using AListPtr = SymbolAList*;
 
   struct SymbolB: Symbol {
+    static constexpr int KIND = USER + 4;
     std::vector<std::string> tc;
     std::vector<std::string> fc;
-    std::string code;
-    SymbolB(std::string name, std::string value, std::vector<std::string> tc, std::vector<std::string> fc, std::string code)
-        : Symbol(std::move(name), std::move(value)), tc(std::move(tc)), fc(std::move(fc)), code(std::move(code)) {}
+    CodeRope code;
+    SymbolB(std::string name, std::string value, std::vector<std::string> tc, std::vector<std::string> fc, CodeRope code)
+        : Symbol(std::move(name), std::move(value), KIND), tc(std::move(tc)), fc(std::move(fc)), code(std::move(code)) {}
   };
-  using BPtr = std::shared_ptr<struct SymbolB>;
+  using BPtr = SymbolB*;
 
   struct SymbolE: Symbol {
-    std::string place;
-    std::string code;
+    static constexpr int KIND = USER + 5;
+    TacOperand place;
+    CodeRope code;
     std::string type;
     std::string num;
-    SymbolE(std::string name, std::string value, std::string place, std::string code, std::string type, std::string const_number)
-        : Symbol(std::move(name), std::move(value)), place(std::move(place)), code(std::move(code)), type(std::move(type)), num(std::move(const_number)) {}
+    SymbolE(std::string name, std::string value, TacOperand place, CodeRope code, std::string type, std::string const_number)
+        : Symbol(std::move(name), std::move(value), KIND), place(std::move(place)), code(std::move(code)), type(std::move(type)), num(std::move(const_number)) {}
   };
-  using EPtr = std::shared_ptr<struct SymbolE>;
+  using EPtr = SymbolE*;
 
   struct SymbolEList: Symbol {
+    static constexpr int KIND = USER + 6;
     std::vector<std::string> place;
     std::vector<std::string> code;
     SymbolEList(std::string name, std::string value, std::vector<std::string> place, std::vector<std::string> code)
-        : Symbol(std::move(name), std::move(value)), place(std::move(place)), code(std::move(code)) {}
+        : Symbol(std::move(name), std::move(value), KIND), place(std::move(place)), code(std::move(code)) {}
   };
-  using EListPtr = std::shared_ptr<struct SymbolEList>;
+  using EListPtr = SymbolEList*;
 
   struct SymbolP: Symbol {
-    std::vector<std::string> code;
-    SymbolP(std::string name, std::string value, std::vector<std::string> code)
-        : Symbol(std::move(name), std::move(value)), code(std::move(code)) {}
+    static constexpr int KIND = USER + 7;
+    CodeRope code;
+    SymbolP(std::string name, std::string value, CodeRope code)
+        : Symbol(std::move(name), std::move(value), KIND), code(std::move(code)) {}
   };
-  using PPtr = std::shared_ptr<struct SymbolP>;
+  using PPtr = SymbolP*;
 
   struct SymbolR: Symbol {
-    std::string place;
-    std::string code;
+    static constexpr int KIND = USER + 8;
+    TacOperand place;
+    CodeRope code;
 
-    SymbolR(std::string name, std::string value, std::string place, std::string code)
-        : Symbol(std::move(name), std::move(value)), place(std::move(place)), code(std::move(code)) {}
+    SymbolR(std::string name, std::string value, TacOperand place, CodeRope code)
+        : Symbol(std::move(name), std::move(value), KIND), place(std::move(place)), code(std::move(code)) {}
   };
-  using RPtr = std::shared_ptr<struct SymbolR>;
+  using RPtr = SymbolR*;
 
   struct SymbolRList: Symbol {
-    std::vector<std::string> place;
-    std::vector<std::string> code;
-    SymbolRList(std::string name, std::string value, std::vector<std::string> place, std::vector<std::string> code)
-        : Symbol(std::move(name), std::move(value)), place(std::move(place)), code(std::move(code)) {}
+    static constexpr int KIND = USER + 9;
+    std::vector<TacOperand> place;
+    CodeRope code;
+    SymbolRList(std::string name, std::string value, std::vector<TacOperand> place, CodeRope code)
+        : Symbol(std::move(name), std::move(value), KIND), place(std::move(place)), code(std::move(code)) {}
   };
-  using RListPtr = std::shared_ptr<struct SymbolRList>;
+  using RListPtr = SymbolRList*;
 
   struct SymbolS: Symbol {
-    std::string code;
-    SymbolS(std::string name, std::string value, std::string code)
-        : Symbol(std::move(name), std::move(value)), code(std::move(code)) {}
+    static constexpr int KIND = USER + 10;
+    CodeRope code;
+    SymbolS(std::string name, std::string value, CodeRope code)
+        : Symbol(std::move(name), std::move(value), KIND), code(std::move(code)) {}
   };
-  using SPtr = std::shared_ptr<struct SymbolS>;
+  using SPtr = SymbolS*;
 
   struct SymbolSList: Symbol {
-    std::vector<std::string> code;
-    SymbolSList(std::string name, std::string value, std::vector<std::string> code)
-        : Symbol(std::move(name), std::move(value)), code(std::move(code)) {}
+    static constexpr int KIND = USER + 11;
+    CodeRope code;
+    SymbolSList(std::string name, std::string value, CodeRope code)
+        : Symbol(std::move(name), std::move(value), KIND), code(std::move(code)) {}
   };
-  using SListPtr = std::shared_ptr<struct SymbolSList>;
+  using SListPtr = SymbolSList*;
 
   explicit SyntaxZyl(const SLRTable &slr_table);
 
@@ -223,7 +266,7 @@ private:
   unsigned int variable_count_ = 0; // 变量计数器
   unsigned int label_count_ = 0; // 标签计数器
   using AttrEqnFuncPtr = SymbolPtr (SyntaxZyl::*)(const std::vector<SymbolPtr>&);
-  std::unordered_map<Grammar, AttrEqnFuncPtr, Grammar::Hash> reduce_map_;
+  std::vector<AttrEqnFuncPtr> reduce_handlers_; // 产生式编号 -> 属性方程，构造时按分析表解析
 
   // 移进/归约
   bool shift(int state_id, const Lexical::Token &token) override;
@@ -233,6 +276,11 @@ private:
   // P -> D' S'
   Syntax::SymbolPtr reduce_program(const std::vector<SymbolPtr> &symbols);
 
+  // 文法 2, 3
+  // D' -> ε
+  // D' -> D' D ;
+  Syntax::SymbolPtr reduce_declarations(const std::vector<SymbolPtr> &symbols);
+
   // 文法 4
   // D -> T d
   Syntax::SymbolPtr reduce_declaration_var(const std::vector<SymbolPtr> &symbols);
@@ -397,22 +445,22 @@ private:
   // 辅助函数
 
 
-  std::string new_var();
+  TacOperand new_var();
 
   std::string new_label();
 
-  std::string gen_code(const std::string& instruction, const std::string& label);
+  static CodeRope gen_label(const std::string& label);
 
-  std::string gen_code(const std::string& instruction, const std::vector<std::string> &labels);
+  static CodeRope gen_labels(const std::vector<std::string> &labels);
+
+  static CodeRope gen_goto(const std::string& label);
 
   std::string new_labels(const std::vector<std::string> &labels);
 
-  std::string new_params(const std::vector<std::string> &parlist);
+  static CodeRope new_params(const std::vector<TacOperand> &parlist);
 
   std::vector<std::string> merge_list(const std::vector<std::string> &list1, const std::vector<std::string> &list2);
 
-  std::string merge_code(const std::vector<std::string> &code_list);
-
   EntryPtr check_var(std::string d);
 
   void add_equation(const Grammar& grammar, AttrEqnFuncPtr handler);
@@ -0,0 +1,228 @@
+#include "tac.hpp"
+
+#include <sstream>
+
+TacInstruction TacInstruction::assign(TacOperand dst, TacOperand src) {
+  TacInstruction instruction;
+  instruction.op = TacOp::ASSIGN;
+  instruction.dst = std::move(dst);
+  instruction.src1 = std::move(src);
+  return instruction;
+}
+
+TacInstruction TacInstruction::binary(TacOperand dst, TacOperand left, std::string oper, TacOperand right) {
+  TacInstruction instruction;
+  instruction.op = TacOp::BINARY;
+  instruction.oper = std::move(oper);
+  instruction.dst = std::move(dst);
+  instruction.src1 = std::move(left);
+  instruction.src2 = std::move(right);
+  return instruction;
+}
+
+TacInstruction TacInstruction::load_array(TacOperand dst, TacOperand array, TacOperand index) {
+  TacInstruction instruction;
+  instruction.op = TacOp::LOAD_ARRAY;
+  instruction.dst = std::move(dst);
+  instruction.src1 = std::move(array);
+  instruction.src2 = std::move(index);
+  return instruction;
+}
+
+TacInstruction TacInstruction::store_array(TacOperand array, TacOperand index, TacOperand value) {
+  TacInstruction instruction;
+  instruction.op = TacOp::STORE_ARRAY;
+  instruction.dst = std::move(array);
+  instruction.src1 = std::move(index);
+  instruction.src2 = std::move(value);
+  return instruction;
+}
+
+TacInstruction TacInstruction::label(TacOperand label) {
+  TacInstruction instruction;
+  instruction.op = TacOp::LABEL;
+  instruction.target = std::move(label);
+  return instruction;
+}
+
+TacInstruction TacInstruction::jump(TacOperand label) {
+  TacInstruction instruction;
+  instruction.op = TacOp::GOTO;
+  instruction.target = std::move(label);
+  return instruction;
+}
+
+TacInstruction TacInstruction::branch(TacOperand left, std::string oper, TacOperand right,
+                                      TacOperand on_true, TacOperand on_false) {
+  TacInstruction instruction;
+  instruction.op = TacOp::IF;
+  instruction.oper = std::move(oper);
+  instruction.src1 = std::move(left);
+  instruction.src2 = std::move(right);
+  instruction.target = std::move(on_true);
+  instruction.alternative = std::move(on_false);
+  return instruction;
+}
+
+TacInstruction TacInstruction::param(TacOperand value) {
+  TacInstruction instruction;
+  instruction.op = TacOp::PARAM;
+  instruction.src1 = std::move(value);
+  return instruction;
+}
+
+TacInstruction TacInstruction::call(TacOperand dst, TacOperand function, const int argc) {
+  TacInstruction instruction;
+  instruction.op = TacOp::CALL;
+  instruction.dst = std::move(dst);
+  instruction.target = std::move(function);
+  instruction.argc = argc;
+  return instruction;
+}
+
+TacInstruction TacInstruction::ret(TacOperand value) {
+  TacInstruction instruction;
+  instruction.op = TacOp::RETURN;
+  instruction.src1 = std::move(value);
+  return instruction;
+}
+
+TacInstruction TacInstruction::print(TacOperand value) {
+  TacInstruction instruction;
+  instruction.op = TacOp::PRINT;
+  instruction.src1 = std::move(value);
+  return instruction;
+}
+
+TacInstruction TacInstruction::input(TacOperand variable) {
+  TacInstruction instruction;
+  instruction.op = TacOp::INPUT;
+  instruction.dst = std::move(variable);
+  return instruction;
+}
+
+const TacOperand* TacInstruction::defined() const {
+  switch (op) {
+    case TacOp::ASSIGN:
+    case TacOp::BINARY:
+    case TacOp::LOAD_ARRAY:
+    case TacOp::CALL:
+    case TacOp::INPUT:
+      return &dst;
+    default:
+      return nullptr;
+  }
+}
+
+void TacInstruction::used(std::vector<const TacOperand*>& out) const {
+  out.clear();
+  switch (op) {
+    case TacOp::ASSIGN:
+    case TacOp::PARAM:
+    case TacOp::RETURN:
+    case TacOp::PRINT:
+      out.push_back(&src1);
+      break;
+    case TacOp::BINARY:
+    case TacOp::IF:
+    case TacOp::STORE_ARRAY:
+      out.push_back(&src1);
+      out.push_back(&src2);
+      break;
+    case TacOp::LOAD_ARRAY:
+      out.push_back(&src2);
+      break;
+    case TacOp::CALL:
+      out.push_back(&target);
+      break;
+    default:
+      break;
+  }
+}
+
+void TacInstruction::tokens(std::vector<std::string_view>& out, std::string& buffer) const {
+  out.clear();
+  switch (op) {
+    case TacOp::ASSIGN:
+      out = { dst.name, "=", src1.name, ";" };
+      break;
+    case TacOp::BINARY:
+      out = { dst.name, "=", src1.name, oper, src2.name, ";" };
+      break;
+    case TacOp::LOAD_ARRAY:
+      out = { dst.name, "=", src1.name, "[", src2.name, "]", ";" };
+      break;
+    case TacOp::STORE_ARRAY:
+      out = { dst.name, "[", src1.name, "]", "=", src2.name, ";" };
+      break;
+    case TacOp::LABEL:
+      out = { "LABEL", target.name, ";" };
+      break;
+    case TacOp::GOTO:
+      out = { "GOTO", target.name, ";" };
+      break;
+    case TacOp::IF:
+      out = { "IF", src1.name, oper, src2.name, "THEN", target.name, "ELSE", alternative.name, ";" };
+      break;
+    case TacOp::PARAM:
+      out = { "PAR", src1.name, ";" };
+      break;
+    case TacOp::CALL:
+      buffer = std::to_string(argc);
+      out = { dst.name, "=", "CALL", target.name, ",", buffer, ";" };
+      break;
+    case TacOp::RETURN:
+      out = { "RETURN", src1.name, ";" };
+      break;
+    case TacOp::PRINT:
+      out = { "PRINT", src1.name, ";" };
+      break;
+    case TacOp::INPUT:
+      out = { "INPUT", dst.name, ";" };
+      break;
+  }
+}
+
+std::ostream& operator<<(std::ostream& os, const TacInstruction& instruction) {
+  switch (instruction.op) {
+    case TacOp::ASSIGN:
+      return os << instruction.dst.name << " = " << instruction.src1.name << ";";
+    case TacOp::BINARY:
+      return os << instruction.dst.name << " = " << instruction.src1.name << " " << instruction.oper << " "
+                << instruction.src2.name << ";";
+    case TacOp::LOAD_ARRAY:
+      return os << instruction.dst.name << " = " << instruction.src1.name << "[" << instruction.src2.name << "];";
+    case TacOp::STORE_ARRAY:
+      return os << instruction.dst.name << "[" << instruction.src1.name << "] = " << instruction.src2.name << ";";
+    case TacOp::LABEL:
+      return os << "LABEL " << instruction.target.name << ";";
+    case TacOp::GOTO:
+      return os << "GOTO " << instruction.target.name << ";";
+    case TacOp::IF:
+      return os << "IF " << instruction.src1.name << " " << instruction.oper << " " << instruction.src2.name
+                << " THEN " << instruction.target.name << " ELSE " << instruction.alternative.name << ";";
+    case TacOp::PARAM:
+      return os << "PAR " << instruction.src1.name << ";";
+    case TacOp::CALL:
+      return os << instruction.dst.name << " = CALL " << instruction.target.name << ", " << instruction.argc << ";";
+    case TacOp::RETURN:
+      return os << "RETURN " << instruction.src1.name << ";";
+    case TacOp::PRINT:
+      return os << "PRINT " << instruction.src1.name << ";";
+    case TacOp::INPUT:
+      return os << "INPUT " << instruction.dst.name << ";";
+  }
+  return os;
+}
+
+void print_tac(std::ostream& os, const TacCode& code) {
+  for (const auto& instruction : code) {
+    os << instruction << "\n";
+  }
+}
+
+std::string tac_to_string(const TacCode& code) {
+  std::ostringstream os;
+  print_tac(os, code);
+  return os.str();
+}
@@ -0,0 +1,97 @@
+#ifndef TAC_HPP
+#define TAC_HPP
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// 三地址代码的操作数
+struct TacOperand {
+  enum Kind : uint8_t {
+    NONE,     // 无
+    TEMP,     // 临时变量 t0, t1, ...
+    VARIABLE, // 源程序中的变量、数组、参数
+    CONSTANT, // 整数或浮点常量，保留源文本
+    LABEL,    // 标号 l0, l1, ...
+    FUNCTION, // 函数名
+  };
+
+  Kind kind = NONE;
+  std::string name; // 打印时的文本
+
+  static TacOperand temp(std::string name) { return { TEMP, std::move(name) }; }
+  static TacOperand variable(std::string name) { return { VARIABLE, std::move(name) }; }
+  static TacOperand constant(std::string text) { return { CONSTANT, std::move(text) }; }
+  static TacOperand label(std::string name) { return { LABEL, std::move(name) }; }
+  static TacOperand function(std::string name) { return { FUNCTION, std::move(name) }; }
+
+  bool empty() const { return kind == NONE; }
+  bool operator==(const TacOperand& other) const { return kind == other.kind && name == other.name; }
+  bool operator!=(const TacOperand& other) const { return !(*this == other); }
+};
+
+// 三地址指令的操作码
+enum class TacOp : uint8_t {
+  ASSIGN,      // dst = src1;
+  BINARY,      // dst = src1 op src2;
+  LOAD_ARRAY,  // dst = src1[src2];
+  STORE_ARRAY, // dst[src1] = src2;
+  LABEL,       // LABEL target;
+  GOTO,        // GOTO target;
+  IF,          // IF src1 op src2 THEN target ELSE alternative;
+  PARAM,       // PAR src1;
+  CALL,        // dst = CALL target, argc;
+  RETURN,      // RETURN src1;
+  PRINT,       // PRINT src1;
+  INPUT,       // INPUT dst;
+};
+
+// 三地址指令：各操作码用到的字段见 TacOp 的注释
+struct TacInstruction {
+  TacOp op = TacOp::ASSIGN;
+  std::string oper;        // BINARY 的算术运算符、IF 的关系运算符
+  TacOperand dst;
+  TacOperand src1;
+  TacOperand src2;
+  TacOperand target;       // 标号、跳转目标或被调用的函数
+  TacOperand alternative;  // IF 不成立时的跳转目标
+  int argc = 0;            // CALL 的参数个数
+
+  static TacInstruction assign(TacOperand dst, TacOperand src);
+  static TacInstruction binary(TacOperand dst, TacOperand left, std::string oper, TacOperand right);
+  static TacInstruction load_array(TacOperand dst, TacOperand array, TacOperand index);
+  static TacInstruction store_array(TacOperand array, TacOperand index, TacOperand value);
+  static TacInstruction label(TacOperand label);
+  static TacInstruction jump(TacOperand label);
+  static TacInstruction branch(TacOperand left, std::string oper, TacOperand right, TacOperand on_true, TacOperand on_false);
+  static TacInstruction param(TacOperand value);
+  static TacInstruction call(TacOperand dst, TacOperand function, int argc);
+  static TacInstruction ret(TacOperand value);
+  static TacInstruction print(TacOperand value);
+  static TacInstruction input(TacOperand variable);
+
+  // 定值的操作数（ASSIGN / BINARY / LOAD_ARRAY / CALL / INPUT 的 dst），没有时返回 nullptr
+  const TacOperand* defined() const;
+
+  // 作为值引用的操作数，依次写入 out（不含数组名和标号；CALL 的被调用者也算引用，它可能是函数指针参数）
+  void used(std::vector<const TacOperand*>& out) const;
+
+  // 按打印格式切分成记号，如 "t1 = x + t0;" -> t1 = x + t0 ;（不需要打印再解析）
+  // 记号指向指令本身或 buffer（CALL 的参数个数），两者不变时有效
+  void tokens(std::vector<std::string_view>& out, std::string& buffer) const;
+
+  // 输出一行文本（不含换行），格式与语义分析原先生成的文本代码相同，如 "t1 = x + t0;"
+  friend std::ostream& operator<<(std::ostream& os, const TacInstruction& instruction);
+};
+
+using TacCode = std::vector<TacInstruction>;
+
+// 逐行输出一段三地址代码，每条指令后换行
+void print_tac(std::ostream& os, const TacCode& code);
+
+// 一段三地址代码的文本
+std::string tac_to_string(const TacCode& code);
+
+#endif // TAC_HPP
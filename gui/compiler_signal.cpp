@@ -30,7 +30,7 @@ SyntaxZyl analyse_syntax(Text program, Text lexical, Text grammar, Text slr_tabl
 
   // 符号表分析
   SyntaxZyl syntax(slr);
-  syntax.parse(tokens);
+  syntax.parse(tokens, lex);
   return syntax;
 }
 
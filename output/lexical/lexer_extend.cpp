@@ -0,0 +1,1024 @@
+// 由 Lexical::to_cpp 生成，请勿手动修改
+#include "lexer_extend.hpp"
+
+namespace generated {
+
+const char* const lexer_extend_types[lexer_extend_type_count] = {
+  "else",
+  "float",
+  "for",
+  "if",
+  "input",
+  "int",
+  "print",
+  "return",
+  "void",
+  "while",
+  "f",
+  "i",
+  "d",
+  "*",
+  "+",
+  "-",
+  "/",
+  "r",
+  "\342\210\247",
+  "\342\210\250",
+  "(",
+  ")",
+  ",",
+  ";",
+  "=",
+  "NEWLINE",
+  "[",
+  "]",
+  "{",
+  "}",
+  "UNKNOWN",
+};
+
+static bool is_word(unsigned char c) {
+  return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+int lexer_extend_match(const char* begin, const char* end, size_t& length) {
+  const char* p = begin;
+  int best = -1;
+  length = 0;
+  goto next_0;
+
+next_0:
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case 0x0a:
+      goto state_1;
+    case '(':
+      goto state_2;
+    case ')':
+      goto state_3;
+    case '*':
+      goto state_4;
+    case '+':
+      goto state_5;
+    case ',':
+      goto state_6;
+    case '-':
+      goto state_7;
+    case '.':
+      goto state_8;
+    case '/':
+      goto state_9;
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9':
+      goto state_10;
+    case ';':
+      goto state_11;
+    case '<': case '>':
+      goto state_12;
+    case '=':
+      goto state_13;
+    case 'A': case 'B': case 'C': case 'D': case 'E': case 'F': case 'G': case 'H':
+    case 'I': case 'J': case 'K': case 'L': case 'M': case 'N': case 'O': case 'P':
+    case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V': case 'W': case 'X':
+    case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c': case 'd': case 'g':
+    case 'h': case 'j': case 'k': case 'l': case 'm': case 'n': case 'o': case 'q':
+    case 's': case 't': case 'u': case 'x': case 'y': case 'z':
+      goto state_14;
+    case '[':
+      goto state_15;
+    case ']':
+      goto state_16;
+    case 'e':
+      goto state_17;
+    case 'f':
+      goto state_18;
+    case 'i':
+      goto state_19;
+    case 'p':
+      goto state_20;
+    case 'r':
+      goto state_21;
+    case 'v':
+      goto state_22;
+    case 'w':
+      goto state_23;
+    case '{':
+      goto state_24;
+    case '}':
+      goto state_25;
+    case 0xe2:
+      goto state_26;
+    default: return best;
+  }
+
+state_1:
+  { best = 25; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    default: return best;
+  }
+
+state_2:
+  { best = 20; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    default: return best;
+  }
+
+state_3:
+  { best = 21; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    default: return best;
+  }
+
+state_4:
+  { best = 13; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    default: return best;
+  }
+
+state_5:
+  { best = 14; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '.':
+      goto state_8;
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9':
+      goto state_10;
+    default: return best;
+  }
+
+state_6:
+  { best = 22; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    default: return best;
+  }
+
+state_7:
+  { best = 15; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '.':
+      goto state_8;
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9':
+      goto state_10;
+    default: return best;
+  }
+
+state_8:
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9':
+      goto state_27;
+    default: return best;
+  }
+
+state_9:
+  { best = 16; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    default: return best;
+  }
+
+state_10:
+  { best = 11; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9':
+      goto state_10;
+    case '.':
+      goto state_27;
+    default: return best;
+  }
+
+state_11:
+  { best = 23; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    default: return best;
+  }
+
+state_12:
+  { best = 17; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '=':
+      goto state_28;
+    default: return best;
+  }
+
+state_13:
+  { best = 24; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '=':
+      goto state_28;
+    default: return best;
+  }
+
+state_14:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+    case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    default: return best;
+  }
+
+state_15:
+  { best = 26; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    default: return best;
+  }
+
+state_16:
+  { best = 27; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    default: return best;
+  }
+
+state_17:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+    case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 'l':
+      goto state_29;
+    default: return best;
+  }
+
+state_18:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'm': case 'n': case 'p': case 'q': case 'r': case 's': case 't': case 'u':
+    case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 'l':
+      goto state_30;
+    case 'o':
+      goto state_31;
+    default: return best;
+  }
+
+state_19:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+    case 'm': case 'o': case 'p': case 'q': case 'r': case 's': case 't': case 'u':
+    case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 'f':
+      goto state_32;
+    case 'n':
+      goto state_33;
+    default: return best;
+  }
+
+state_20:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 's': case 't':
+    case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 'r':
+      goto state_34;
+    default: return best;
+  }
+
+state_21:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+    case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+    case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 'e':
+      goto state_35;
+    default: return best;
+  }
+
+state_22:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'l': case 'm': case 'n': case 'p': case 'q': case 'r': case 's': case 't':
+    case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 'o':
+      goto state_36;
+    default: return best;
+  }
+
+state_23:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'i': case 'j': case 'k': case 'l':
+    case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+    case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 'h':
+      goto state_37;
+    default: return best;
+  }
+
+state_24:
+  { best = 28; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    default: return best;
+  }
+
+state_25:
+  { best = 29; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    default: return best;
+  }
+
+state_26:
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case 0x88:
+      goto state_38;
+    default: return best;
+  }
+
+state_27:
+  { best = 10; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9':
+      goto state_27;
+    default: return best;
+  }
+
+state_28:
+  { best = 17; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    default: return best;
+  }
+
+state_29:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 't':
+    case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 's':
+      goto state_39;
+    default: return best;
+  }
+
+state_30:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'l': case 'm': case 'n': case 'p': case 'q': case 'r': case 's': case 't':
+    case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 'o':
+      goto state_40;
+    default: return best;
+  }
+
+state_31:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 's': case 't':
+    case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 'r':
+      goto state_41;
+    default: return best;
+  }
+
+state_32:
+  if (is_word(begin[0]) && is_word(p[-1]) != (p < end && is_word(*p))) { best = 3; length = p - begin; }
+  else { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+    case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    default: return best;
+  }
+
+state_33:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'l': case 'm': case 'n': case 'o': case 'q': case 'r': case 's': case 'u':
+    case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 'p':
+      goto state_42;
+    case 't':
+      goto state_43;
+    default: return best;
+  }
+
+state_34:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l':
+    case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+    case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 'i':
+      goto state_44;
+    default: return best;
+  }
+
+state_35:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+    case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 't':
+      goto state_45;
+    default: return best;
+  }
+
+state_36:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l':
+    case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+    case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 'i':
+      goto state_46;
+    default: return best;
+  }
+
+state_37:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'j': case 'k': case 'l':
+    case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+    case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 'i':
+      goto state_47;
+    default: return best;
+  }
+
+state_38:
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case 0xa7:
+      goto state_48;
+    case 0xa8:
+      goto state_49;
+    default: return best;
+  }
+
+state_39:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+    case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+    case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 'e':
+      goto state_50;
+    default: return best;
+  }
+
+state_40:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'b': case 'c': case 'd':
+    case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+    case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+    case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 'a':
+      goto state_51;
+    default: return best;
+  }
+
+state_41:
+  if (is_word(begin[0]) && is_word(p[-1]) != (p < end && is_word(*p))) { best = 2; length = p - begin; }
+  else { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+    case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    default: return best;
+  }
+
+state_42:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+    case 't': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 'u':
+      goto state_52;
+    default: return best;
+  }
+
+state_43:
+  if (is_word(begin[0]) && is_word(p[-1]) != (p < end && is_word(*p))) { best = 5; length = p - begin; }
+  else { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+    case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    default: return best;
+  }
+
+state_44:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'l': case 'm': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+    case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 'n':
+      goto state_53;
+    default: return best;
+  }
+
+state_45:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+    case 't': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 'u':
+      goto state_54;
+    default: return best;
+  }
+
+state_46:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+    case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+    case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 'd':
+      goto state_55;
+    default: return best;
+  }
+
+state_47:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+    case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 'l':
+      goto state_56;
+    default: return best;
+  }
+
+state_48:
+  { best = 18; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    default: return best;
+  }
+
+state_49:
+  { best = 19; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    default: return best;
+  }
+
+state_50:
+  if (is_word(begin[0]) && is_word(p[-1]) != (p < end && is_word(*p))) { best = 0; length = p - begin; }
+  else { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+    case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    default: return best;
+  }
+
+state_51:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+    case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 't':
+      goto state_57;
+    default: return best;
+  }
+
+state_52:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+    case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 't':
+      goto state_58;
+    default: return best;
+  }
+
+state_53:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+    case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 't':
+      goto state_59;
+    default: return best;
+  }
+
+state_54:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 's': case 't':
+    case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 'r':
+      goto state_60;
+    default: return best;
+  }
+
+state_55:
+  if (is_word(begin[0]) && is_word(p[-1]) != (p < end && is_word(*p))) { best = 8; length = p - begin; }
+  else { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+    case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    default: return best;
+  }
+
+state_56:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l':
+    case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+    case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 'e':
+      goto state_61;
+    default: return best;
+  }
+
+state_57:
+  if (is_word(begin[0]) && is_word(p[-1]) != (p < end && is_word(*p))) { best = 1; length = p - begin; }
+  else { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+    case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    default: return best;
+  }
+
+state_58:
+  if (is_word(begin[0]) && is_word(p[-1]) != (p < end && is_word(*p))) { best = 4; length = p - begin; }
+  else { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+    case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    default: return best;
+  }
+
+state_59:
+  if (is_word(begin[0]) && is_word(p[-1]) != (p < end && is_word(*p))) { best = 6; length = p - begin; }
+  else { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+    case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    default: return best;
+  }
+
+state_60:
+  { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'l': case 'm': case 'o': case 'p': case 'q': case 'r': case 's': case 't':
+    case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    case 'n':
+      goto state_62;
+    default: return best;
+  }
+
+state_61:
+  if (is_word(begin[0]) && is_word(p[-1]) != (p < end && is_word(*p))) { best = 9; length = p - begin; }
+  else { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+    case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    default: return best;
+  }
+
+state_62:
+  if (is_word(begin[0]) && is_word(p[-1]) != (p < end && is_word(*p))) { best = 7; length = p - begin; }
+  else { best = 12; length = p - begin; }
+  if (p == end) return best;
+  switch (static_cast<unsigned char>(*p++)) {
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+    case '8': case '9': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V':
+    case 'W': case 'X': case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'l': case 'm': case 'n': case 'o': case 'p': case 'q': case 'r': case 's':
+    case 't': case 'u': case 'v': case 'w': case 'x': case 'y': case 'z':
+      goto state_14;
+    default: return best;
+  }
+}
+
+std::vector<Lexical::Token> lexer_extend_analyze(const std::string& source) {
+  std::vector<Lexical::Token> tokens;
+  const char* end = source.data() + source.size();
+  size_t pos = 0;
+  while (pos < source.size()) {
+    // 跳过空白（换行作为 NEWLINE 记号保留）
+    char c = source[pos];
+    if (c == ' ' || c == '\t' || c == '\r') {
+      ++pos;
+      continue;
+    }
+    size_t length = 0;
+    int type = lexer_extend_match(source.data() + pos, end, length);
+    if (type >= 0) {
+      tokens.push_back({lexer_extend_types[type], source.substr(pos, length)});
+      pos += length;
+    } else {
+      tokens.push_back({lexer_extend_types[30], source.substr(pos, 1)});
+      ++pos;
+    }
+  }
+  return tokens;
+}
+
+} // namespace generated
@@ -0,0 +1,21 @@
+// 由 Lexical::to_cpp 生成，请勿手动修改
+#ifndef LEXER_EXTEND_GENERATED_HPP
+#define LEXER_EXTEND_GENERATED_HPP
+
+#include "basic/lexical.hpp"
+
+namespace generated {
+
+// 类型 id -> 类型字符串（与 Lexical::type_name 相同）
+constexpr size_t lexer_extend_type_count = 31;
+extern const char* const lexer_extend_types[lexer_extend_type_count];
+
+// 从 begin 开始做最长匹配，返回类型 id（-1 表示未匹配），length 为匹配长度
+int lexer_extend_match(const char* begin, const char* end, size_t& length);
+
+// 分析源码文本，结果与 Lexical::analyze 相同
+std::vector<Lexical::Token> lexer_extend_analyze(const std::string& source);
+
+} // namespace generated
+
+#endif // LEXER_EXTEND_GENERATED_HPP
@@ -0,0 +1,536 @@
+// 由 SLRTable::to_header 生成，请勿手动修改
+#ifndef SLR_TABLE_GENERATED_HPP
+#define SLR_TABLE_GENERATED_HPP
+
+#include "basic/slr_table.hpp"
+
+namespace generated {
+
+inline constexpr char slr_table_names[] =
+  "\316\265"
+  "#"
+  "P"
+  "R"
+  "E"
+  "d"
+  "["
+  "]"
+  "("
+  ")"
+  "="
+  "i"
+  "f"
+  "R'"
+  "+"
+  "-"
+  "*"
+  "/"
+  ","
+  "A'"
+  "A"
+  ";"
+  "B"
+  "\342\210\247"
+  "\342\210\250"
+  "r"
+  "T"
+  "int"
+  "void"
+  "float"
+  "D"
+  "{"
+  "D'"
+  "S'"
+  "}"
+  "S"
+  "if"
+  "else"
+  "while"
+  "return"
+  "for"
+  "print"
+  "input"
+  "P'"
+  "Item Set 0"
+  "Item Set 1"
+  "Item Set 2"
+  "Item Set 3"
+  "Item Set 4"
+  "Item Set 5"
+  "Item Set 6"
+  "Item Set 7"
+  "Item Set 8"
+  "Item Set 9"
+  "Item Set 10"
+  "Item Set 11"
+  "Item Set 12"
+  "Item Set 13"
+  "Item Set 14"
+  "Item Set 15"
+  "Item Set 16"
+  "Item Set 17"
+  "Item Set 18"
+  "Item Set 19"
+  "Item Set 20"
+  "Item Set 21"
+  "Item Set 22"
+  "Item Set 23"
+  "Item Set 24"
+  "Item Set 25"
+  "Item Set 26"
+  "Item Set 27"
+  "Item Set 28"
+  "Item Set 29"
+  "Item Set 30"
+  "Item Set 31"
+  "Item Set 32"
+  "Item Set 33"
+  "Item Set 34"
+  "Item Set 35"
+  "Item Set 36"
+  "Item Set 37"
+  "Item Set 38"
+  "Item Set 39"
+  "Item Set 40"
+  "Item Set 41"
+  "Item Set 42"
+  "Item Set 43"
+  "Item Set 44"
+  "Item Set 45"
+  "Item Set 46"
+  "Item Set 47"
+  "Item Set 48"
+  "Item Set 49"
+  "Item Set 50"
+  "Item Set 51"
+  "Item Set 52"
+  "Item Set 53"
+  "Item Set 54"
+  "Item Set 55"
+  "Item Set 56"
+  "Item Set 57"
+  "Item Set 58"
+  "Item Set 59"
+  "Item Set 60"
+  "Item Set 61"
+  "Item Set 62"
+  "Item Set 63"
+  "Item Set 64"
+  "Item Set 65"
+  "Item Set 66"
+  "Item Set 67"
+  "Item Set 68"
+  "Item Set 69"
+  "Item Set 70"
+  "Item Set 71"
+  "Item Set 72"
+  "Item Set 73"
+  "Item Set 74"
+  "Item Set 75"
+  "Item Set 76"
+  "Item Set 77"
+  "Item Set 78"
+  "Item Set 79"
+  "Item Set 80"
+  "Item Set 81"
+  "Item Set 82"
+  "Item Set 83"
+  "Item Set 84"
+  "Item Set 85"
+  "Item Set 86"
+  "Item Set 87"
+  "Item Set 88"
+  "Item Set 89"
+  "Item Set 90"
+  "Item Set 91"
+  "Item Set 92"
+  "Item Set 93"
+  "Item Set 94"
+  "Item Set 95"
+  "Item Set 96"
+  "Item Set 97"
+  "Item Set 98"
+  "Item Set 99"
+  "Item Set 100"
+  "Item Set 101"
+  "Item Set 102"
+  "Item Set 103"
+  "Item Set 104"
+  "Item Set 105"
+  "Item Set 106"
+  "Item Set 107"
+  "Item Set 108"
+  "Item Set 109";
+
+inline constexpr uint32_t slr_table_name_offsets[] = {
+  0, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+  18, 19, 20, 21, 23, 24, 25, 26, 29, 32, 33, 34, 37, 41, 46, 47,
+  48, 50, 52, 53, 54, 56, 60, 65, 71, 74, 79, 84, 86, 96, 106, 116,
+  126, 136, 146, 156, 166, 176, 186, 197, 208, 219, 230, 241, 252, 263, 274, 285,
+  296, 307, 318, 329, 340, 351, 362, 373, 384, 395, 406, 417, 428, 439, 450, 461,
+  472, 483, 494, 505, 516, 527, 538, 549, 560, 571, 582, 593, 604, 615, 626, 637,
+  648, 659, 670, 681, 692, 703, 714, 725, 736, 747, 758, 769, 780, 791, 802, 813,
+  824, 835, 846, 857, 868, 879, 890, 901, 912, 923, 934, 945, 956, 967, 978, 989,
+  1000, 1011, 1022, 1033, 1044, 1055, 1066, 1077, 1088, 1099, 1110, 1121, 1132, 1143, 1154, 1165,
+  1176, 1188, 1200, 1212, 1224, 1236, 1248, 1260, 1272, 1284, 1296
+};
+
+inline constexpr uint32_t slr_table_production_offsets[] = {
+  0, 2, 6, 10, 14, 16, 18, 20, 25, 30, 34, 38, 42, 46, 50, 52,
+  56, 58, 62, 66, 70, 74, 76, 78, 80, 82, 85, 90, 95, 98, 104, 114,
+  118, 125, 131, 139, 145, 148, 158, 161, 164, 168, 173, 175, 179, 181, 185, 188,
+  190
+};
+
+inline constexpr int32_t slr_table_productions[] = {
+  3, 4, 3, 5, 6, 7, 3, 5, 8, 9, 4, 5, 10, 4, 4, 11,
+  4, 12, 4, 5, 4, 5, 6, 4, 7, 4, 5, 8, 13, 9, 4, 4,
+  14, 4, 4, 4, 15, 4, 4, 4, 16, 4, 4, 4, 17, 4, 4, 8,
+  4, 9, 13, 0, 13, 13, 3, 18, 19, 0, 19, 19, 20, 21, 22, 22,
+  23, 22, 22, 22, 24, 22, 22, 4, 25, 4, 22, 4, 26, 27, 26, 28,
+  26, 29, 20, 26, 5, 20, 26, 5, 6, 7, 20, 26, 5, 8, 9, 30,
+  26, 5, 30, 26, 5, 6, 11, 7, 30, 26, 5, 8, 19, 9, 31, 32,
+  33, 34, 35, 5, 10, 4, 35, 5, 6, 4, 7, 10, 4, 35, 36, 8,
+  22, 9, 35, 35, 36, 8, 22, 9, 35, 37, 35, 35, 38, 8, 22, 9,
+  35, 35, 39, 4, 35, 40, 8, 35, 21, 22, 21, 35, 9, 35, 35, 41,
+  4, 35, 42, 5, 35, 31, 33, 34, 35, 5, 8, 13, 9, 32, 0, 32,
+  32, 30, 21, 33, 35, 33, 33, 21, 35, 2, 32, 33, 43, 2
+};
+
+inline constexpr SymbolId slr_table_terminals[] = {
+  1, 5, 6, 7, 8, 9, 10, 11, 12, 14, 15, 16, 17, 18, 21, 23,
+  24, 25, 27, 28, 29, 31, 34, 36, 37, 38, 39, 40, 41, 42
+};
+
+inline constexpr SymbolId slr_table_non_terminals[] = {
+  2, 3, 4, 13, 19, 20, 22, 26, 30, 32, 33, 35
+};
+
+inline constexpr ParseTable::Entry slr_table_actions[] = {
+  0, 2147483690, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2147483690, 2147483690, 2147483690, 2147483690, 0, 2147483690, 0, 2147483690, 2147483690, 2147483690, 2147483690, 2147483690, 3221225472, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741834, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741828, 1073741830,
+  1073741832, 1073741836, 0, 1073741835, 0, 1073741837, 1073741838, 1073741840, 1073741841, 1073741839, 2147483692, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 2147483692, 0, 0, 0, 0, 0, 0, 0,
+  2147483692, 0, 0, 0, 0, 0, 0, 0, 0, 2147483670, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 2147483694, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1073741857, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 2147483671, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1073741854, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 2147483672, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741848,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741851, 0,
+  1073741850, 0, 1073741852, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741855, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741834, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741836, 0, 1073741835,
+  0, 1073741837, 1073741838, 1073741840, 1073741841, 1073741839, 0, 0, 0, 0, 1073741847, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1073741846, 0, 0, 1073741843, 0, 0, 1073741845, 1073741844, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1073741853, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1073741856, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741846,
+  0, 0, 1073741843, 0, 0, 1073741845, 1073741844, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2147483686, 0, 0, 0,
+  0, 2147483686, 0, 0, 0, 1073741869, 1073741867, 1073741868, 1073741866, 0, 2147483686, 0, 0, 0, 0, 0,
+  0, 0, 2147483686, 0, 2147483686, 0, 0, 0, 0, 0, 0, 1073741846, 0, 0, 1073741843, 0,
+  0, 1073741845, 1073741844, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 2147483653, 0, 0, 2147483653, 0, 2147483653, 0, 0,
+  0, 2147483653, 2147483653, 2147483653, 2147483653, 2147483653, 2147483653, 2147483653, 2147483653, 2147483653, 0, 0, 0, 0, 2147483653, 0,
+  2147483653, 0, 0, 0, 0, 0, 2147483652, 0, 0, 2147483652, 0, 2147483652, 0, 0, 0, 2147483652,
+  2147483652, 2147483652, 2147483652, 2147483652, 2147483652, 2147483652, 2147483652, 2147483652, 0, 0, 0, 0, 2147483652, 0, 2147483652, 0,
+  0, 0, 0, 0, 2147483654, 0, 1073741872, 2147483654, 1073741871, 2147483654, 1073741873, 0, 0, 2147483654, 2147483654, 2147483654,
+  2147483654, 2147483654, 2147483654, 2147483654, 2147483654, 2147483654, 0, 0, 0, 0, 2147483654, 0, 2147483654, 0, 0, 0,
+  0, 0, 0, 1073741846, 0, 0, 1073741843, 0, 0, 1073741845, 1073741844, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1073741876, 0, 1073741875, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2147483676, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2147483684, 0,
+  0, 0, 0, 2147483684, 0, 0, 0, 1073741869, 1073741867, 1073741868, 1073741866, 0, 2147483684, 0, 0, 0,
+  0, 0, 0, 0, 2147483684, 0, 2147483684, 0, 0, 0, 0, 0, 0, 2147483662, 0, 0,
+  2147483662, 2147483662, 0, 2147483662, 2147483662, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741846, 0, 0, 1073741843, 0,
+  0, 1073741845, 1073741844, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741846, 0, 0, 1073741843, 0, 0, 1073741845,
+  1073741844, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 2147483687, 0, 0, 0, 0, 2147483687, 0, 0, 0, 0,
+  0, 0, 0, 0, 2147483687, 0, 0, 0, 0, 0, 0, 0, 2147483687, 0, 2147483687, 0,
+  0, 0, 0, 0, 0, 2147483691, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 2147483691, 2147483691, 2147483691, 2147483691, 0, 2147483691, 0, 2147483691, 2147483691, 2147483691,
+  2147483691, 2147483691, 0, 1073741846, 0, 0, 1073741843, 0, 0, 1073741845, 1073741844, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1073741834, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1073741836, 0, 1073741835, 0, 1073741837, 1073741838, 1073741840, 1073741841, 1073741839, 0, 1073741834,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1073741836, 0, 1073741835, 0, 1073741837, 1073741838, 1073741840, 1073741841, 1073741839, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741857, 0, 0, 0, 0, 0,
+  0, 0, 1073741865, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741898,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741889, 1073741888, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2147483669, 0, 0,
+  0, 1073741869, 1073741867, 1073741868, 1073741866, 0, 2147483669, 2147483669, 2147483669, 1073741892, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741891, 0, 0, 0, 0, 0, 1073741869,
+  1073741867, 1073741868, 1073741866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1073741890, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2147483679, 0, 0, 0, 0, 2147483679, 0, 0, 0, 1073741869, 1073741867, 1073741868, 1073741866, 0,
+  2147483679, 0, 0, 0, 0, 0, 0, 0, 2147483679, 0, 2147483679, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1073741887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741889,
+  1073741888, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2147483688, 0,
+  0, 0, 0, 2147483688, 0, 0, 0, 0, 0, 0, 0, 0, 2147483688, 0, 0, 0,
+  0, 0, 0, 0, 2147483688, 0, 2147483688, 0, 0, 0, 0, 0, 0, 1073741846, 0, 0,
+  1073741843, 0, 0, 1073741845, 1073741844, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741846, 0, 0, 1073741843, 0,
+  0, 1073741845, 1073741844, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741846, 0, 0, 1073741843, 0, 0, 1073741845,
+  1073741844, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1073741846, 0, 0, 1073741843, 0, 0, 1073741845, 1073741844, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741895, 0, 0, 0, 1073741869, 1073741867, 1073741868,
+  1073741866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 2147483662, 0, 0, 2147483662, 2147483662, 0, 2147483662, 2147483662, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1073741846, 0, 0, 1073741843, 0, 0, 1073741845, 1073741844, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741846,
+  0, 0, 1073741843, 0, 0, 1073741845, 1073741844, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2147483693, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2147483693, 0, 0, 0, 0, 0,
+  0, 0, 2147483693, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2147483664,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2147483664, 2147483664, 2147483664, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741883,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1073741881, 0, 0, 1073741843, 1073741878, 0, 1073741845, 1073741844, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2147483689, 0, 0, 0, 0, 2147483689, 0, 0, 0, 0, 0, 0,
+  0, 0, 2147483689, 0, 0, 0, 0, 0, 0, 0, 2147483689, 0, 2147483689, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741914,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741869, 1073741867, 1073741868, 1073741866, 2147483648, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2147483654, 0,
+  1073741907, 2147483654, 1073741906, 2147483654, 1073741873, 0, 0, 2147483654, 2147483654, 2147483654, 2147483654, 2147483654, 2147483654, 2147483654, 2147483654, 2147483654,
+  0, 0, 0, 0, 2147483654, 0, 2147483654, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1073741909, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741828, 1073741830,
+  1073741832, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741904, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 2147483651, 0, 0, 2147483651, 0, 2147483651, 0, 0,
+  0, 1073741869, 1073741867, 1073741868, 1073741866, 2147483651, 2147483651, 2147483651, 2147483651, 2147483651, 0, 0, 0, 0, 2147483651, 0,
+  2147483651, 0, 0, 0, 0, 0, 0, 0, 0, 1073741903, 0, 0, 0, 0, 0, 1073741869,
+  1073741867, 1073741868, 1073741866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2147483660, 0, 0, 2147483660, 0, 2147483660, 0, 0, 0, 2147483660, 2147483660, 2147483660,
+  2147483660, 2147483660, 2147483660, 2147483660, 2147483660, 2147483660, 0, 0, 0, 0, 2147483660, 0, 2147483660, 0, 0, 0,
+  0, 0, 0, 1073741834, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1073741836, 0, 1073741835, 0, 1073741837, 1073741838, 1073741840, 1073741841, 1073741839,
+  0, 1073741846, 0, 0, 1073741843, 0, 0, 1073741845, 1073741844, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741846,
+  0, 0, 1073741843, 0, 0, 1073741845, 1073741844, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741846, 0, 0,
+  1073741843, 0, 0, 1073741845, 1073741844, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1073741901, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741846, 0, 0, 1073741843, 0, 0, 1073741845,
+  1073741844, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 2147483657, 0, 0, 2147483657, 0, 2147483657, 0, 0, 0, 2147483657,
+  2147483657, 1073741868, 1073741866, 2147483657, 2147483657, 2147483657, 2147483657, 2147483657, 0, 0, 0, 0, 2147483657, 0, 2147483657, 0,
+  0, 0, 0, 0, 0, 1073741881, 0, 0, 1073741843, 1073741899, 0, 1073741845, 1073741844, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2147483661, 0, 0, 2147483661, 0, 2147483661, 0, 0, 0, 2147483661, 2147483661, 2147483661, 2147483661, 2147483661,
+  2147483661, 2147483661, 2147483661, 2147483661, 0, 0, 0, 0, 2147483661, 0, 2147483661, 0, 0, 0, 0, 0,
+  2147483658, 0, 0, 2147483658, 0, 2147483658, 0, 0, 0, 2147483658, 2147483658, 1073741868, 1073741866, 2147483658, 2147483658, 2147483658,
+  2147483658, 2147483658, 0, 0, 0, 0, 2147483658, 0, 2147483658, 0, 0, 0, 0, 0, 2147483659, 0,
+  0, 2147483659, 0, 2147483659, 0, 0, 0, 2147483659, 2147483659, 2147483659, 2147483659, 2147483659, 2147483659, 2147483659, 2147483659, 2147483659,
+  0, 0, 0, 0, 2147483659, 0, 2147483659, 0, 0, 0, 0, 0, 0, 1073741834, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1073741836, 0, 1073741835, 0, 1073741837, 1073741838, 1073741840, 1073741841, 1073741839, 2147483656, 0, 0, 2147483656, 0, 2147483656,
+  0, 0, 0, 2147483656, 2147483656, 2147483656, 2147483656, 2147483656, 2147483656, 2147483656, 2147483656, 2147483656, 0, 0, 0, 0,
+  2147483656, 0, 2147483656, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2147483668, 0, 0,
+  0, 1073741869, 1073741867, 1073741868, 1073741866, 0, 2147483668, 2147483668, 2147483668, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1073741846, 0, 0, 1073741843, 0, 0, 1073741845, 1073741844, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 2147483667, 0, 0, 0, 0, 0, 0,
+  0, 0, 2147483667, 1073741889, 2147483667, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2147483655, 0, 0, 2147483655, 0, 2147483655, 0, 0, 0, 2147483655, 2147483655, 2147483655, 2147483655, 2147483655,
+  2147483655, 2147483655, 2147483655, 2147483655, 0, 0, 0, 0, 2147483655, 0, 2147483655, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2147483677, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2147483681, 0,
+  0, 0, 0, 2147483681, 0, 0, 0, 0, 0, 0, 0, 0, 2147483681, 0, 0, 0,
+  0, 0, 0, 0, 2147483681, 0, 1073741918, 0, 0, 0, 0, 0, 0, 2147483662, 0, 0,
+  2147483662, 1073741921, 0, 2147483662, 2147483662, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741846, 0, 1073741917, 1073741843, 0,
+  0, 1073741845, 1073741844, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2147483666, 0, 0,
+  0, 0, 0, 0, 0, 0, 2147483666, 2147483666, 2147483666, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741920, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1073741922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1073741916, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2147483683, 0, 0, 0, 0, 2147483683, 0, 0, 0, 0, 0, 0, 0, 0, 2147483683, 0,
+  0, 0, 0, 0, 0, 0, 2147483683, 0, 2147483683, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741915, 1073741889, 1073741888, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2147483663, 0, 0,
+  2147483663, 2147483663, 0, 2147483663, 2147483663, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741834, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741836,
+  0, 1073741835, 0, 1073741837, 1073741838, 1073741840, 1073741841, 1073741839, 0, 0, 0, 0, 0, 2147483665, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2147483665, 2147483665, 2147483665, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 2147483649, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1073741834, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741836, 0, 1073741835, 0, 1073741837, 1073741838, 1073741840,
+  1073741841, 1073741839, 2147483680, 0, 0, 0, 0, 2147483680, 0, 0, 0, 1073741869, 1073741867, 1073741868, 1073741866, 0,
+  2147483680, 0, 0, 0, 0, 0, 0, 0, 2147483680, 0, 2147483680, 0, 0, 0, 0, 0,
+  0, 2147483690, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2147483690, 2147483690, 2147483690, 2147483690, 0, 2147483690, 0, 2147483690, 2147483690, 2147483690, 2147483690, 2147483690, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2147483650, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741926, 0,
+  1073741925, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2147483673, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741834, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741828, 1073741830, 1073741832, 1073741836,
+  0, 1073741835, 0, 1073741837, 1073741838, 1073741840, 1073741841, 1073741839, 0, 0, 0, 0, 0, 1073741931, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741930, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1073741929, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2147483682, 0, 0, 0, 0, 2147483682, 0, 0, 0, 0, 0, 0, 0, 0,
+  2147483682, 0, 0, 0, 0, 0, 0, 0, 2147483682, 0, 2147483682, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741857, 0,
+  0, 0, 0, 0, 0, 0, 1073741932, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2147483674, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2147483675, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741834, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073741836,
+  0, 1073741835, 0, 1073741837, 1073741838, 1073741840, 1073741841, 1073741839, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 2147483678, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 2147483685, 0, 0, 0, 0, 2147483685, 0, 0, 0, 0,
+  0, 0, 0, 0, 2147483685, 0, 0, 0, 0, 0, 0, 0, 2147483685, 0, 2147483685, 0,
+  0, 0, 0, 0
+};
+
+inline constexpr int32_t slr_table_gotos[] = {
+  1, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 9,
+  7, -1, 5, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 34, 3, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 25, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 18, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 46, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 36, -1, -1, -1, 40, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 53, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 37, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 39, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 36, -1, -1, -1, 35, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 38, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 50, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 62, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 72, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 73, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 69, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 70, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 61, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 60, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 58, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 55, 56, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 87, -1, 86,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 88,
+  -1, -1, 36, -1, -1, -1, 78, -1, -1, -1, -1, -1, -1, -1, 36, -1,
+  -1, -1, 84, -1, -1, -1, -1, -1, -1, -1, 36, -1, -1, -1, 89, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, 76, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 55, 56, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, 81, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 95, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 70, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 61, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 100,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, 103, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 99, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 9, 7, -1, 104, 3,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 109,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1
+};
+
+inline constexpr int32_t slr_table_accept_states[] = {
+  1, 3, 4, 5, 6, 8, 18, 20, 21, 22, 24, 25, 29, 30, 36, 39,
+  41, 50, 54, 56, 57, 60, 62, 69, 71, 72, 73, 75, 76, 78, 79, 80,
+  81, 84, 88, 90, 92, 93, 95, 97, 98, 103, 105, 106, 108, 109
+};
+
+inline constexpr uint32_t slr_table_conflict_offsets[] = {
+  0
+};
+
+inline constexpr uint32_t slr_table_conflicts[] = {0};
+
+inline constexpr SLRTable::Image slr_table = {
+  13726516229549621138ull, 0,
+  44, 48, 110, 30, 12, 46, 0,
+  0, 1,
+  slr_table_name_offsets,
+  slr_table_names,
+  slr_table_production_offsets,
+  slr_table_productions,
+  slr_table_terminals,
+  slr_table_non_terminals,
+  slr_table_actions,
+  slr_table_gotos,
+  slr_table_accept_states,
+  slr_table_conflict_offsets,
+  slr_table_conflicts
+};
+
+} // namespace generated
+
+#endif // SLR_TABLE_GENERATED_HPP
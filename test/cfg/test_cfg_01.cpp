@@ -0,0 +1,100 @@
+//
+// 控制流图：基本块划分、前驱后继、支配树、不可达块、自然循环嵌套深度与 dot 输出
+//
+#include "basic/cfg.hpp"
+#include "basic/code.hpp"
+#include "basic/slr_table.hpp"
+#include <fstream>
+#include <sstream>
+
+int main() {
+  int failed = 0;
+  auto check = [&](bool ok, const std::string& what) {
+    if (!ok) {
+      std::cerr << "失败: " << what << std::endl;
+      failed++;
+    }
+  };
+
+  const TacOperand t0 = TacOperand::temp("t0");
+  const TacOperand t1 = TacOperand::temp("t1");
+  auto label = [](const std::string& name) { return TacOperand::label(name); };
+
+  // while (t0 < t1) { if (t0 == t1) {} else t0 = t0 + t1 }; print t0; return t0; 之后的 print 不可达
+  const TacCode code = {
+    TacInstruction::assign(t0, TacOperand::constant("0")),                // B0
+    TacInstruction::label(label("l2")),                                   // B1
+    TacInstruction::branch(t0, "<", t1, label("l0"), label("l1")),
+    TacInstruction::label(label("l0")),                                   // B2
+    TacInstruction::branch(t0, "==", t1, label("l3"), label("l4")),
+    TacInstruction::label(label("l3")),                                   // B3
+    TacInstruction::jump(label("l5")),
+    TacInstruction::label(label("l4")),                                   // B4
+    TacInstruction::binary(t0, t0, "+", t1),
+    TacInstruction::label(label("l5")),                                   // B5
+    TacInstruction::jump(label("l2")),
+    TacInstruction::label(label("l1")),                                   // B6
+    TacInstruction::print(t0),
+    TacInstruction::ret(t0),
+    TacInstruction::print(t1),                                            // B7
+  };
+  ControlFlowGraph cfg(code);
+  const size_t NONE = ControlFlowGraph::NONE;
+
+  check(cfg.size() == 8, "块数");
+  check(cfg.block(1).begin == 1 && cfg.block(1).end == 3 && cfg.block(1).label == "l2", "块范围");
+  check(cfg.block(0).label.empty() && cfg.block(7).begin == 14 && cfg.block(7).end == 15, "块范围");
+  check(cfg.block_of(0) == 0 && cfg.block_of(8) == 4 && cfg.block_of(14) == 7, "指令所在块");
+
+  const std::vector<std::vector<size_t>> successors = { { 1 }, { 2, 6 }, { 3, 4 }, { 5 }, { 5 }, { 1 }, {}, {} };
+  for (size_t b = 0; b < cfg.size(); ++b) check(cfg.block(b).successors == successors[b], "后继 B" + std::to_string(b));
+  check(cfg.block(1).predecessors == std::vector<size_t>{ 0, 5 }, "前驱");
+  check(cfg.block(5).predecessors == std::vector<size_t>{ 3, 4 }, "前驱");
+
+  const std::vector<size_t> idom = { NONE, 0, 1, 2, 2, 2, 1, NONE };
+  for (size_t b = 0; b < cfg.size(); ++b) check(cfg.immediate_dominator(b) == idom[b], "直接支配者 B" + std::to_string(b));
+  check(cfg.dominator_children(2) == std::vector<size_t>{ 3, 4, 5 }, "支配树");
+  check(cfg.dominates(1, 5) && cfg.dominates(0, 6) && cfg.dominates(4, 4), "支配关系");
+  check(!cfg.dominates(3, 5) && !cfg.dominates(6, 1) && !cfg.dominates(0, 7), "支配关系");
+  check(cfg.reachable(6) && !cfg.reachable(7) && cfg.reverse_postorder().size() == 7, "可达");
+
+  const std::vector<int> depth = { 0, 1, 1, 1, 1, 1, 0, 0 };
+  for (size_t b = 0; b < cfg.size(); ++b) check(cfg.loop_depth(b) == depth[b], "循环深度 B" + std::to_string(b));
+
+  std::ostringstream dot;
+  cfg.to_dot(dot, "f");
+  check(dot.str().find("digraph \"f\" {") == 0, "dot 头");
+  check(dot.str().find("\"B5\" -> \"B1\";") != std::string::npos, "dot 控制流边");
+  check(dot.str().find("\"B2\" -> \"B5\" [style=dashed, color=gray];") != std::string::npos, "dot 支配树边");
+  check(dot.str().find("IF t0 < t1 THEN l0 ELSE l1;\\l") != std::string::npos, "dot 指令");
+
+  // 语义分析生成的嵌套循环，以及 Code 按函数输出的 dot
+  const SLRTable slr_table = SLRTable::load_or_build(SLR_TABLE_EXTEND_BINARY, GRAMMAR_EXTEND, "P", SLR_CONFLICT_EXTEND);
+  const std::string text =
+    "int i;\n"
+    "int j;\n"
+    "i = 0;\n"
+    "while (i < 3) { j = 0; while (j < 3) j = j + 1; i = i + 1 };\n"
+    "print i\n";
+  Lexical lexical(LEXICAL_EXTEND);
+  SyntaxZyl syntax(slr_table);
+  check(syntax.parse(lexical.analyze(text), lexical), "语法分析");
+  const TacCode& program = syntax.symbol_table().at("system_table")->code;
+  ControlFlowGraph nested(program);
+  int max_depth = 0;
+  for (size_t b = 0; b < nested.size(); ++b) max_depth = std::max(max_depth, nested.loop_depth(b));
+  check(max_depth == 2, "嵌套循环深度");
+  check(nested.loop_depth(nested.block_of(program.size() - 1)) == 0, "循环之后");
+
+  Code generator(syntax);
+  generator.cfg_to_dot("test_cfg_01.dot");
+  std::ifstream file("test_cfg_01.dot");
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  std::remove("test_cfg_01.dot");
+  check(buffer.str().find("subgraph \"cluster_main\"") != std::string::npos, "Code::cfg_to_dot");
+  check(buffer.str().find("\"main_B0\"") != std::string::npos, "Code::cfg_to_dot 结点名");
+
+  std::cout << "错误数: " << failed << std::endl;
+  return failed;
+}
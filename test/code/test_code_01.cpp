@@ -0,0 +1,83 @@
+//
+// MIPS 指令选择：mips.json 的规则全部编译成记号模式，输出与原先逐行 regex 替换的结果相同；
+// 子集之外的模式退回 std::regex；输出耗时随指令数线性增长
+//
+#include "basic/mips_selector.hpp"
+#include "basic/code.hpp"
+#include <chrono>
+#include <sstream>
+
+// 选择一条指令的 MIPS 代码，没有规则匹配时返回 "<none>"
+static std::string select(const MipsSelector& selector, const TacInstruction& instruction) {
+  std::ostringstream out;
+  return selector.select(instruction, out) ? out.str() : "<none>";
+}
+
+int main() {
+  int failed = 0;
+  auto check = [&](const std::string& actual, const std::string& expected) {
+    if (actual != expected) {
+      std::cerr << "期望:\n" << expected << "实际:\n" << actual << std::endl;
+      failed++;
+    }
+  };
+
+  MipsSelector selector;
+  selector.load(MIPS_REGEX_FILE);
+  if (selector.rule_count() != 20 || selector.regex_rule_count() != 0) failed++;
+
+  const TacOperand x = TacOperand::variable("x");
+  const TacOperand a = TacOperand::variable("a");
+  const TacOperand t0 = TacOperand::temp("t0");
+  const TacOperand t1 = TacOperand::temp("t1");
+  const TacOperand l0 = TacOperand::label("l0");
+  const TacOperand l1 = TacOperand::label("l1");
+
+  check(select(selector, TacInstruction::binary(t1, x, "+", t0)), "  add $t1, $x, $t0\n");
+  check(select(selector, TacInstruction::binary(t1, x, "/", t0)), "  div $x, $t0\n  mflo $t1\n");
+  check(select(selector, TacInstruction::assign(t1, TacOperand::constant("7"))), "  li $t1, 7\n");
+  check(select(selector, TacInstruction::assign(x, t1)), "  move $x, $t1\n");
+  check(select(selector, TacInstruction::load_array(t1, a, t0)),
+        "  la $v1, a\n  sll $at, $t0, 2\n  add $at, $at, $v1\n  lw $t1, 0($at)\n");
+  check(select(selector, TacInstruction::store_array(a, t0, t1)),
+        "  la $v1, a\n  sll $at, $t0, 2\n  add $at, $at, $v1\n  sw $t1, 0($at)\n");
+  check(select(selector, TacInstruction::branch(x, "<=", t0, l0, l1)), "  bgt $x, $t0, l1\n  j l0\n");
+  check(select(selector, TacInstruction::branch(x, "!=", t0, l0, l1)), "  beq $x, $t0, l1\n  j l0\n");
+  check(select(selector, TacInstruction::label(l0)), "l0:\n");
+  check(select(selector, TacInstruction::call(t1, TacOperand::function("foo"), 2)),
+        "  jal foo\n  lw $t1, 0($sp)\n  addi $sp, $sp, 4\n");
+
+  // 没有对应规则：浮点常量、与常量比较、INPUT
+  check(select(selector, TacInstruction::assign(t1, TacOperand::constant("1.5"))), "<none>");
+  check(select(selector, TacInstruction::branch(x, "!=", TacOperand::constant("0"), l0, l1)), "<none>");
+  check(select(selector, TacInstruction::input(x)), "<none>");
+
+  // 子集之外的模式退回 std::regex，模板照常替换
+  selector.add_rule("input", "INPUT\\s+(.+);", "li $v0, 5\\nsyscall\\nmove \\$$1, $v0");
+  if (selector.regex_rule_count() != 1) failed++;
+  check(select(selector, TacInstruction::input(x)), "  li $v0, 5\n  syscall\n  move $x, $v0\n");
+
+  // 输出随指令数线性增长
+  auto run = [&](int n) {
+    TacCode code;
+    for (int i = 0; i < n; ++i) {
+      TacOperand t = TacOperand::temp("t" + std::to_string(i));
+      code.push_back(TacInstruction::assign(t, TacOperand::constant(std::to_string(i))));
+      code.push_back(TacInstruction::binary(x, x, "+", t));
+      code.push_back(TacInstruction::branch(x, "<", t, l0, l1));
+    }
+    std::ostringstream out;
+    auto begin = std::chrono::steady_clock::now();
+    for (const auto& instruction : code) {
+      if (!selector.select(instruction, out)) failed++;
+    }
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+  };
+  const double small = run(20000);
+  const double large = run(80000);
+  std::cout << "指令 60000 / 240000 条: " << small << " ms / " << large << " ms（比值 " << large / small << "）"
+            << std::endl;
+
+  std::cout << "错误数: " << failed << std::endl;
+  return failed == 0 ? 0 : 1;
+}
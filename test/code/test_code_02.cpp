@@ -0,0 +1,226 @@
+//
+// O1 / O2 寄存器分配：生成的 MIPS 程序在一个小解释器上运行，打印的结果与源程序的语义一致；
+// 跨过调用的值放在 $s 寄存器中，寄存器不够时溢出到栈帧
+//
+#include "basic/code.hpp"
+#include "basic/slr_table.hpp"
+#include <fstream>
+#include <sstream>
+
+namespace {
+
+// 只实现 Code 生成的指令子集，syscall 1 的输出收集到 printed
+struct MipsMachine {
+  std::vector<std::vector<std::string>> program;  // 每条指令：助记符和操作数
+  std::unordered_map<std::string, int> labels;    // 代码标号 -> 指令下标，数据标号 -> 地址
+  std::unordered_map<std::string, int> registers;
+  std::unordered_map<int, int> memory;
+  std::vector<int> printed;
+  std::string error;
+
+  static constexpr int CODE_BASE = 0x00400000;
+  static constexpr int DATA_BASE = 0x10010000;
+
+  explicit MipsMachine(const std::string& text) {
+    std::istringstream in(text);
+    std::string line;
+    bool data = false;
+    int data_end = DATA_BASE;
+    while (std::getline(in, line)) {
+      line.erase(0, line.find_first_not_of(' '));
+      if (line.empty()) continue;
+      if (line == ".data" || line == ".text") {
+        data = line == ".data";
+        continue;
+      }
+      size_t colon = line.find(':');
+      if (data) {
+        std::istringstream directive(line.substr(colon + 1));
+        std::string kind;
+        int size;
+        directive >> kind >> size;
+        labels[line.substr(0, colon)] = data_end;
+        data_end += kind == ".space" ? size : 4;
+        continue;
+      }
+      if (colon != std::string::npos) {
+        labels[line.substr(0, colon)] = static_cast<int>(program.size());
+        continue;
+      }
+      std::vector<std::string> instruction;
+      std::istringstream words(line);
+      std::string word;
+      words >> word;
+      instruction.push_back(word);
+      while (words >> word) {
+        if (word.back() == ',') word.pop_back();
+        instruction.push_back(word);
+      }
+      program.push_back(instruction);
+    }
+  }
+
+  int& reg(const std::string& name) {
+    static int zero;
+    zero = 0;
+    return name == "$zero" ? zero : registers[name];
+  }
+
+  // "8($sp)" 或数据标号
+  int address(const std::string& operand) {
+    size_t paren = operand.find('(');
+    if (paren == std::string::npos) return labels.at(operand);
+    return std::stoi(operand.substr(0, paren)) + reg(operand.substr(paren + 1, operand.size() - paren - 2));
+  }
+
+  bool run(int max_steps = 1000000) {
+    reg("$sp") = 0x7fff0000;
+    int pc = labels.count("main") ? labels["main"] : 0;
+    for (int step = 0; step < max_steps; ++step) {
+      if (pc < 0 || pc >= static_cast<int>(program.size())) {
+        error = "pc 越界";
+        return false;
+      }
+      const auto& in = program[pc++];
+      const std::string& op = in[0];
+      auto value = [&](size_t k) { return reg(in[k]); };
+      auto jump = [&](const std::string& label) { pc = labels.at(label); };
+      if (op == "add") reg(in[1]) = value(2) + value(3);
+      else if (op == "sub") reg(in[1]) = value(2) - value(3);
+      else if (op == "mul") reg(in[1]) = value(2) * value(3);
+      else if (op == "div") reg("$lo") = value(1) / value(2);
+      else if (op == "mflo") reg(in[1]) = reg("$lo");
+      else if (op == "sll") reg(in[1]) = value(2) << std::stoi(in[3]);
+      else if (op == "addi") reg(in[1]) = value(2) + std::stoi(in[3]);
+      else if (op == "li") reg(in[1]) = std::stoi(in[2]);
+      else if (op == "move") reg(in[1]) = value(2);
+      else if (op == "la") {
+        // 汇编器把 la 展开成 lui $at, hi; ori rd, $at, lo，$at 被改写
+        int target = labels.at(in[2]);
+        target = target >= DATA_BASE ? target : CODE_BASE + 4 * target;
+        reg("$at") = target & ~0xffff;
+        reg(in[1]) = target;
+      }
+      else if (op == "lw") reg(in[1]) = memory[address(in[2])];
+      else if (op == "sw") memory[address(in[2])] = value(1);
+      else if (op == "blt") { if (value(1) < value(2)) jump(in[3]); }
+      else if (op == "ble") { if (value(1) <= value(2)) jump(in[3]); }
+      else if (op == "bgt") { if (value(1) > value(2)) jump(in[3]); }
+      else if (op == "bge") { if (value(1) >= value(2)) jump(in[3]); }
+      else if (op == "beq") { if (value(1) == value(2)) jump(in[3]); }
+      else if (op == "bne") { if (value(1) != value(2)) jump(in[3]); }
+      else if (op == "j") jump(in[1]);
+      else if (op == "jal") { reg("$ra") = CODE_BASE + 4 * pc; jump(in[1]); }
+      else if (op == "jalr") { reg("$ra") = CODE_BASE + 4 * pc; pc = (value(1) - CODE_BASE) / 4; }
+      else if (op == "jr") pc = (value(1) - CODE_BASE) / 4;
+      else if (op == "syscall" && reg("$v0") == 1) printed.push_back(reg("$a0"));
+      else if (op == "syscall" && reg("$v0") == 10) return true;
+      else {
+        error = "未知指令 " + op;
+        return false;
+      }
+    }
+    error = "超出步数";
+    return false;
+  }
+};
+
+std::string read_file(const std::string& filename) {
+  std::ifstream in(filename);
+  std::stringstream buffer;
+  buffer << in.rdbuf();
+  return buffer.str();
+}
+
+} // namespace
+
+int main() {
+  int failed = 0;
+
+  const SLRTable slr_table = SLRTable::load_or_build(SLR_TABLE_EXTEND_BINARY, GRAMMAR_EXTEND, "P", SLR_CONFLICT_EXTEND);
+
+  // 分别以 O1、O2 编译并运行 text，打印的整数序列应为 expected；返回 O1 生成的汇编
+  auto check = [&](const std::string& name, const std::string& text, const std::vector<int>& expected) {
+    Lexical lexical(LEXICAL_EXTEND);
+    SyntaxZyl syntax(slr_table);
+    if (!syntax.parse(lexical.analyze(text), lexical)) {
+      std::cerr << name << ": 语法分析失败" << std::endl;
+      failed++;
+      return std::string();
+    }
+    Code code(syntax);
+    code.parse_mips_regex(MIPS_REGEX_FILE);
+    std::string o1;
+    for (auto level : { Code::OptLevel::O1, Code::OptLevel::O2 }) {
+      code.set_opt_level(level);
+      const std::string filename = "test_code_02_" + name + ".s";
+      code.to_mips(filename);
+      const std::string mips = read_file(filename);
+      std::remove(filename.c_str());
+      if (level == Code::OptLevel::O1) o1 = mips;
+
+      MipsMachine machine(mips);
+      if (!machine.run() || machine.printed != expected) {
+        std::cerr << name << " O" << static_cast<int>(level) << ": " << machine.error << "\n" << mips << "输出:";
+        for (int value : machine.printed) std::cerr << ' ' << value;
+        std::cerr << std::endl;
+        failed++;
+      }
+    }
+    return o1;
+  };
+
+  // 循环与数组
+  check("loop",
+        "int a[10];\n"
+        "int i;\n"
+        "int s;\n"
+        "i = 0;\n"
+        "while (i < 10) { a[i] = i * i; i = i + 1 };\n"
+        "i = 0;\n"
+        "s = 0;\n"
+        "while (i < 10) { s = s + a[i]; i = i + 1 };\n"
+        "print s;\n"
+        "print a[7]\n",
+        { 285, 49 });
+
+  // 第一次调用的结果跨过第二次调用，参数 a 跨过两次调用
+  const std::string calls = check("calls",
+        "int square(int n;) { return n * n };\n"
+        "int sum(int a; int b;) {\n"
+        "  int r;\n"
+        "  r = square(a,) + square(b,);\n"
+        "  return r + a\n"
+        "};\n"
+        "print sum(3, 4,)\n",
+        { 28 });
+  if (calls.find("sw $s0") == std::string::npos || calls.find("lw $s0") == std::string::npos) failed++;
+
+  // 同时活跃的临时变量多于寄存器个数，需要溢出
+  std::string expression = "20";
+  for (int k = 19; k >= 1; --k) expression = std::to_string(k) + " + (" + expression + ")";
+  const std::string deep = check("spill", "print " + expression + "\n", { 210 });
+  if (deep.find("($fp)") == std::string::npos) failed++;
+
+  // 内层函数访问外层变量（放在静态区），函数作为参数传递后经 jalr 调用
+  const std::string nested = check("nested",
+        "int twice(int x;) { return x + x };\n"
+        "void outer(int y;) {\n"
+        "  int z;\n"
+        "  void inner(int f();) { z = f(y,) };\n"
+        "  inner(twice(),);\n"
+        "  print z\n"
+        "};\n"
+        "outer(21,)\n",
+        { 42 });
+  if (nested.find("jalr") == std::string::npos || nested.find("outer_z: .word 0") == std::string::npos) failed++;
+
+  // 参数 a 先定值后引用，入口处不活跃，可以与 c 共用寄存器，序言不能装入它
+  check("dead_param",
+        "void f(int c; int a;) { print c; a = c + 1; print a };\n"
+        "f(7, 9,)\n",
+        { 7, 8 });
+
+  std::cout << "错误数: " << failed << std::endl;
+  return failed;
+}
@@ -0,0 +1,174 @@
+//
+// 图着色寄存器分配：move 链合并成一个寄存器，冲突的值分到不同寄存器，
+// 寄存器不够时溢出循环外、代价低的值，跨过调用的值只用被调用者保存的寄存器；
+// 先定值后引用的参数不在入口处占用寄存器，序言也不装入它；O2 省去的 move 不少于 O1
+//
+#include "basic/register_allocator.hpp"
+#include "basic/code.hpp"
+#include "basic/slr_table.hpp"
+#include <fstream>
+#include <sstream>
+
+int main() {
+  int failed = 0;
+
+  const TacOperand x = TacOperand::variable("x");
+  const TacOperand y = TacOperand::variable("y");
+  const TacOperand t0 = TacOperand::temp("t0");
+  const TacOperand t1 = TacOperand::temp("t1");
+  const TacOperand t2 = TacOperand::temp("t2");
+  const TacOperand l0 = TacOperand::label("l0");
+  const TacOperand l1 = TacOperand::label("l1");
+  const Liveness::Predicate names = [](const TacOperand& operand) {
+    return operand.kind == TacOperand::TEMP || operand.kind == TacOperand::VARIABLE;
+  };
+  auto allocate = [&](const TacCode& code, std::vector<std::string> caller, std::vector<std::string> callee) {
+    return GraphColoringAllocator(std::move(caller), std::move(callee)).allocate(code, Liveness(code, names));
+  };
+
+  // move 链 t0 -> x -> y 合并成一个结点
+  {
+    const TacCode code = {
+      TacInstruction::assign(t0, TacOperand::constant("1")),
+      TacInstruction::assign(x, t0),
+      TacInstruction::assign(y, x),
+      TacInstruction::print(y),
+    };
+    RegisterAssignment assignment = allocate(code, LinearScanAllocator::CALLER_SAVED, LinearScanAllocator::CALLEE_SAVED);
+    if (assignment.coalesced != 2 || !assignment.spilled.empty() ||
+        assignment.registers["t0"] != assignment.registers["x"] || assignment.registers["x"] != assignment.registers["y"]) {
+      std::cerr << "move 链没有合并" << std::endl;
+      failed++;
+    }
+  }
+
+  // t0 与 t1、t2 冲突，t1 与 t2 不冲突：两个寄存器足够
+  {
+    const TacCode code = {
+      TacInstruction::assign(t0, TacOperand::constant("1")),
+      TacInstruction::assign(t1, TacOperand::constant("2")),
+      TacInstruction::binary(t2, t0, "+", t1),
+      TacInstruction::print(t0),
+      TacInstruction::print(t2),
+    };
+    RegisterAssignment assignment = allocate(code, { "$t0", "$t1" }, {});
+    if (!assignment.spilled.empty() || assignment.registers["t0"] == assignment.registers["t1"] ||
+        assignment.registers["t0"] == assignment.registers["t2"]) {
+      std::cerr << "两个寄存器着色失败" << std::endl;
+      failed++;
+    }
+  }
+
+  // 只有一个寄存器：溢出只在循环外引用一次的 t1，保留循环中的 t0
+  {
+    const TacCode code = {
+      TacInstruction::assign(t0, TacOperand::constant("1")),
+      TacInstruction::assign(t1, TacOperand::constant("2")),
+      TacInstruction::label(l0),
+      TacInstruction::binary(t0, t0, "+", t0),
+      TacInstruction::branch(t0, "<", t0, l0, l1),
+      TacInstruction::label(l1),
+      TacInstruction::print(t1),
+    };
+    RegisterAssignment assignment = allocate(code, { "$t0" }, {});
+    if (assignment.spilled != std::vector<std::string>{ "t1" } || assignment.registers["t0"] != "$t0") {
+      std::cerr << "溢出代价没有按循环加权" << std::endl;
+      failed++;
+    }
+  }
+
+  // t0 跨过调用，只能用 $s 寄存器并记入需要保存的寄存器
+  {
+    const TacCode code = {
+      TacInstruction::assign(t0, TacOperand::constant("1")),
+      TacInstruction::call(t1, TacOperand::function("f"), 0),
+      TacInstruction::print(t0),
+      TacInstruction::print(t1),
+    };
+    RegisterAssignment assignment = allocate(code, { "$t0", "$t1" }, { "$s0" });
+    if (assignment.registers["t0"] != "$s0" || assignment.registers["t1"] != "$t0" ||
+        assignment.saved_registers != std::vector<std::string>{ "$s0" }) {
+      std::cerr << "跨过调用的值没有分到 $s 寄存器" << std::endl;
+      failed++;
+    }
+  }
+
+  // 参数 c 入口处活跃，参数 a 先定值后引用：两者不冲突，一个寄存器足够
+  {
+    const TacOperand c = TacOperand::variable("c");
+    const TacOperand a = TacOperand::variable("a");
+    const TacCode code = {
+      TacInstruction::print(c),
+      TacInstruction::binary(t0, c, "*", c),
+      TacInstruction::assign(a, t0),
+      TacInstruction::print(a),
+    };
+    RegisterAssignment assignment = allocate(code, { "$t0" }, {});
+    if (!assignment.spilled.empty() || assignment.registers["c"] != "$t0" || assignment.registers["a"] != "$t0") {
+      std::cerr << "入口处不活跃的参数占用了寄存器" << std::endl;
+      failed++;
+    }
+  }
+
+  // 整个程序：O2 省去的 move 不少于 O1，统计中每个函数一项
+  {
+    const SLRTable slr_table = SLRTable::load_or_build(SLR_TABLE_EXTEND_BINARY, GRAMMAR_EXTEND, "P", SLR_CONFLICT_EXTEND);
+    const std::string text =
+      "int scale(int a; int b;) {\n"
+      "  int c;\n"
+      "  int d;\n"
+      "  c = a * b;\n"
+      "  d = c + a;\n"
+      "  c = d - b;\n"
+      "  return c\n"
+      "};\n"
+      "int k;\n"
+      "k = scale(3, 4,);\n"
+      "print k\n";
+    Lexical lexical(LEXICAL_EXTEND);
+    SyntaxZyl syntax(slr_table);
+    if (!syntax.parse(lexical.analyze(text), lexical)) failed++;
+    Code code(syntax);
+    code.parse_mips_regex(MIPS_REGEX_FILE);
+
+    auto moves_removed = [&](Code::OptLevel level) {
+      code.set_opt_level(level);
+      code.to_mips("test_code_03.s");
+      std::remove("test_code_03.s");
+      size_t removed = 0;
+      for (const auto& report : code.allocation_report()) removed += report.moves_removed;
+      return removed;
+    };
+    const size_t o1 = moves_removed(Code::OptLevel::O1);
+    const size_t o2 = moves_removed(Code::OptLevel::O2);
+    const auto& report = code.allocation_report();
+    if (report.size() != 2 || report[0].function != "main" || report[1].function != "scale" ||
+        report[1].moves != 3 || o2 != 4 || o2 < o1) {
+      std::cerr << "move 统计: O1 删除 " << o1 << "，O2 删除 " << o2 << std::endl;
+      failed++;
+    }
+    if (moves_removed(Code::OptLevel::O0) != 0 || !code.allocation_report().empty()) failed++;
+
+    // 与 c 共用寄存器的参数 a 入口处不活跃，序言只装入 c
+    Lexical dead_lexical(LEXICAL_EXTEND);
+    SyntaxZyl dead_syntax(slr_table);
+    if (!dead_syntax.parse(dead_lexical.analyze("void f(int c; int a;) { print c; a = c + 1; print a };\nf(7, 9,)\n"), dead_lexical)) {
+      failed++;
+    }
+    Code dead_code(dead_syntax);
+    dead_code.parse_mips_regex(MIPS_REGEX_FILE);
+    dead_code.set_opt_level(Code::OptLevel::O2);
+    dead_code.to_mips("test_code_03.s");
+    std::ifstream file("test_code_03.s");
+    std::stringstream mips;
+    mips << file.rdbuf();
+    std::remove("test_code_03.s");
+    if (mips.str().find(", 0($fp)") == std::string::npos || mips.str().find(", 4($fp)") != std::string::npos) {
+      std::cerr << "序言装入了入口处不活跃的参数:\n" << mips.str();
+      failed++;
+    }
+  }
+
+  std::cout << "错误数: " << failed << std::endl;
+  return failed;
+}
@@ -0,0 +1,74 @@
+//
+// 闭包模板：与逐项 DFS 求闭包的结果（含顺序）一致，并对比耗时
+//
+#include "basic/item.hpp"
+#include "basic/grammar.hpp"
+#include <chrono>
+#include <iostream>
+#include <sstream>
+
+// 合成一个较大的文法：levels 层运算符优先级链 + 若干语句
+static std::string synthetic_grammar(int levels) {
+  std::ostringstream oss;
+  oss << "P -> L\n";
+  oss << "L -> L S | S\n";
+  oss << "S -> id = E0 ; | if ( E0 ) S | if ( E0 ) S else S | while ( E0 ) S | { L } | return E0 ;\n";
+  for (int i = 0; i < levels; ++i) {
+    oss << "E" << i << " -> E" << i << " op" << i << " E" << i + 1 << " | E" << i + 1 << "\n";
+  }
+  oss << "E" << levels << " -> ( E0 ) | id | num | id ( A ) | - E" << levels << "\n";
+  oss << "A -> A , E0 | E0 | ε\n";
+  return oss.str();
+}
+
+static double elapsed_ms(std::chrono::steady_clock::time_point begin) {
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+}
+
+static int run(const std::string& name, const GrammarSet& grammar_set, int rounds) {
+  auto begin = std::chrono::steady_clock::now();
+  ItemCluster cluster(grammar_set);
+  cluster.build();
+  double build_ms = elapsed_ms(begin);
+
+  const GrammarSet& bound = cluster.grammar_set();
+  int mismatch = 0;
+  for (const auto& [state_name, state] : cluster.states()) {
+    if (!(ItemSet::closure(state.kernel, bound) == ItemSet::closure_dfs(state.kernel, bound))) {
+      std::cerr << name << ": " << state_name << " 的闭包不一致" << std::endl;
+      mismatch++;
+    }
+  }
+
+  begin = std::chrono::steady_clock::now();
+  size_t items = 0;
+  for (int r = 0; r < rounds; ++r) {
+    for (const auto& [state_name, state] : cluster.states()) {
+      items += ItemSet::closure_dfs(state.kernel, bound).items().size();
+    }
+  }
+  double dfs_ms = elapsed_ms(begin);
+
+  begin = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; ++r) {
+    for (const auto& [state_name, state] : cluster.states()) {
+      items += ItemSet::closure(state.kernel, bound).items().size();
+    }
+  }
+  double template_ms = elapsed_ms(begin);
+
+  std::cout << name << ": " << bound.productions().size() << " 条产生式, "
+            << cluster.states().size() << " 个状态, 构建 " << build_ms << " ms" << std::endl;
+  std::cout << "  闭包 x" << rounds << "  DFS: " << dfs_ms << " ms  模板: " << template_ms
+            << " ms  加速 " << dfs_ms / template_ms << "x" << std::endl;
+  return mismatch + (items == 0 ? 1 : 0);
+}
+
+int main() {
+  int failed = 0;
+  failed += run(GRAMMAR_EXTEND, GrammarSet(GRAMMAR_EXTEND, "P"), 50);
+  failed += run("synthetic(200)", GrammarSet(synthetic_grammar(200), "P"), 3);
+
+  std::cout << "不一致的闭包数: " << failed << std::endl;
+  return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,60 @@
+//
+// DFA 与 std::regex 两种匹配引擎的结果对照
+//
+#include "basic/lexical.hpp"
+#include "utils/format.hpp"
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+static bool same_tokens(const std::vector<Lexical::Token>& a, const std::vector<Lexical::Token>& b) {
+  if (a.size() != b.size()) return false;
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (a[i].type != b[i].type || a[i].lexeme != b[i].lexeme) return false;
+  }
+  return true;
+}
+
+int main() {
+  int failed = 0;
+  for (const auto& rule_file : {LEXICAL_NORMAL, LEXICAL_EXTEND}) {
+    Lexical dfa(rule_file);
+    Lexical regex(rule_file);
+    regex.set_engine(Lexical::Engine::REGEX);
+
+    std::string large;
+    for (int index = 1; index <= 3; ++index) {
+      std::string program_file = index_format("input/program/program", index, ".txt");
+      std::ifstream in(program_file);
+      std::stringstream buffer;
+      buffer << in.rdbuf();
+      large += buffer.str() + "\n";
+
+      if (!same_tokens(dfa.analyze(program_file), regex.analyze(program_file))) {
+        std::cerr << rule_file << " " << program_file << ": 两种引擎结果不同" << std::endl;
+        failed++;
+      }
+    }
+
+    // 放大输入，对比耗时
+    std::string text = large;
+    for (int i = 0; i < 2; ++i) text += text;
+
+    auto t0 = std::chrono::steady_clock::now();
+    auto dfa_tokens = dfa.analyze(text);
+    auto t1 = std::chrono::steady_clock::now();
+    auto regex_tokens = regex.analyze(text);
+    auto t2 = std::chrono::steady_clock::now();
+
+    if (!same_tokens(dfa_tokens, regex_tokens)) {
+      std::cerr << rule_file << " 放大输入: 两种引擎结果不同" << std::endl;
+      failed++;
+    }
+
+    std::cout << rule_file << ": " << text.size() << " 字节, " << dfa_tokens.size() << " 个记号" << std::endl;
+    std::cout << "  DFA:   " << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms" << std::endl;
+    std::cout << "  regex: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << " ms" << std::endl;
+  }
+  return failed == 0 ? 0 : 1;
+}
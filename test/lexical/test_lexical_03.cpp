@@ -0,0 +1,56 @@
+//
+// 零拷贝词法会话：与 Token 接口结果一致，并对比内存占用
+//
+#include "basic/lexical.hpp"
+#include "utils/format.hpp"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+// Token 序列占用的字节数（对象本身 + 超出短字符串优化的堆内存）
+static size_t token_memory(const std::vector<Lexical::Token>& tokens) {
+  size_t bytes = tokens.capacity() * sizeof(Lexical::Token);
+  const size_t sso = std::string().capacity();
+  for (const auto& tok : tokens) {
+    if (tok.type.capacity() > sso) bytes += tok.type.capacity() + 1;
+    if (tok.lexeme.capacity() > sso) bytes += tok.lexeme.capacity() + 1;
+  }
+  return bytes;
+}
+
+int main() {
+  Lexical lexical(LEXICAL_EXTEND);
+
+  std::string text;
+  for (int index = 1; index <= 3; ++index) {
+    std::ifstream in(index_format("input/program/program", index, ".txt"));
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    text += buffer.str() + "\n";
+  }
+  // 放大到数 MB
+  while (text.size() < (4u << 20)) text += text;
+
+  std::vector<Lexical::Token> tokens = lexical.analyze(text);
+  Lexical::Session session = lexical.scan(text);
+
+  int failed = 0;
+  if (session.size() != tokens.size()) {
+    std::cerr << "记号数不同: " << session.size() << " vs " << tokens.size() << std::endl;
+    return 1;
+  }
+  for (size_t i = 0; i < tokens.size(); ++i) {
+    const auto& tok = session[i];
+    if (session.type_name(tok) != tokens[i].type || session.lexeme(tok) != tokens[i].lexeme) {
+      std::cerr << "第 " << i << " 个记号不同: " << session.token(i) << " vs " << tokens[i] << std::endl;
+      failed++;
+      break;
+    }
+  }
+
+  std::cout << text.size() << " 字节, " << tokens.size() << " 个记号" << std::endl;
+  std::cout << "  Token:   " << token_memory(tokens) << " 字节" << std::endl;
+  std::cout << "  Session: " << session.memory_usage() - session.source().capacity() << " 字节 (另有源码 "
+            << session.source().capacity() << " 字节)" << std::endl;
+  return failed == 0 ? 0 : 1;
+}
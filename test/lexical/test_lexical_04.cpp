@@ -0,0 +1,115 @@
+//
+// 生成的专用词法分析器：输出生成的源文件（每个标号都有 goto 跳到）；
+// 链接了 lexer_extend 时与 Lexical::analyze 逐个记号对照并对比耗时
+//
+#include "basic/lexical.hpp"
+#include "utils/format.hpp"
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <regex>
+#include <set>
+#include <sstream>
+
+#ifdef LEXER_EXTEND_GENERATED
+#include "lexer_extend.hpp"
+
+static double elapsed_ms(std::chrono::steady_clock::time_point begin) {
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+}
+
+// 返回不一致的记号数
+static int compare(Lexical& lexical, const std::string& text, bool report) {
+  auto begin = std::chrono::steady_clock::now();
+  std::vector<Lexical::Token> expected = lexical.analyze(text);
+  double lexical_ms = elapsed_ms(begin);
+
+  begin = std::chrono::steady_clock::now();
+  std::vector<Lexical::Token> tokens = generated::lexer_extend_analyze(text);
+  double generated_ms = elapsed_ms(begin);
+
+  int mismatch = tokens.size() == expected.size() ? 0 : 1;
+  for (size_t i = 0; i < tokens.size() && i < expected.size(); ++i) {
+    if (tokens[i].type != expected[i].type || tokens[i].lexeme != expected[i].lexeme) mismatch++;
+  }
+  if (report) {
+    // 只比较匹配：零拷贝会话 vs 直接调用生成的匹配函数
+    begin = std::chrono::steady_clock::now();
+    size_t session_tokens = lexical.scan(text).size();
+    double scan_ms = elapsed_ms(begin);
+
+    begin = std::chrono::steady_clock::now();
+    size_t match_tokens = 0;
+    for (size_t pos = 0, length = 0; pos < text.size(); ++match_tokens) {
+      char c = text[pos];
+      if (c == ' ' || c == '\t' || c == '\r') {
+        ++pos;
+        --match_tokens;
+        continue;
+      }
+      pos += generated::lexer_extend_match(text.data() + pos, text.data() + text.size(), length) >= 0 ? length : 1;
+    }
+    double match_ms = elapsed_ms(begin);
+    if (session_tokens != match_tokens) mismatch++;
+
+    std::cout << text.size() << " 字节, " << expected.size() << " 个记号:\n"
+              << "  Token:  Lexical::analyze " << lexical_ms << " ms, lexer_extend_analyze " << generated_ms << " ms\n"
+              << "  只匹配: Lexical::scan " << scan_ms << " ms, lexer_extend_match " << match_ms << " ms" << std::endl;
+  }
+  return mismatch;
+}
+#endif
+
+int main() {
+  Lexical lexical(LEXICAL_EXTEND);
+  int failed = 0;
+  if (!lexical.to_cpp("output/lexical/lexer_extend.cpp", "output/lexical/lexer_extend.hpp", "lexer_extend")) failed++;
+
+  // 没有 goto 的标号会引起 -Wunused-label
+  {
+    std::ifstream in("output/lexical/lexer_extend.cpp");
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    const std::string source = buffer.str();
+    const std::regex label_pattern(R"(\n(\w+):\n)"), goto_pattern(R"(goto (\w+);)");
+    std::set<std::string> targets;
+    for (std::sregex_iterator it(source.begin(), source.end(), goto_pattern), last; it != last; ++it) {
+      targets.insert((*it)[1]);
+    }
+    for (std::sregex_iterator it(source.begin(), source.end(), label_pattern), last; it != last; ++it) {
+      if (!targets.count((*it)[1])) {
+        std::cerr << "没有用到的标号: " << (*it)[1] << std::endl;
+        failed++;
+      }
+    }
+  }
+
+#ifdef LEXER_EXTEND_GENERATED
+  std::string text;
+  for (int index = 1; index <= 3; ++index) {
+    std::ifstream in(index_format("input/program/program", index, ".txt"));
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    text += buffer.str() + "\n";
+  }
+  while (text.size() < (1u << 20)) text += text;
+  failed += compare(lexical, text, true);
+
+  // 随机输入（含 UTF-8 的 ∧ ∨ 和非法字节）
+  const std::vector<std::string> pieces = {"if", "ifx", "else", "_a1", "12", "+3", "-4.5", ".5", "7.", "<=", "<",
+                                           "==", "=", ">", "∧", "∨", "\xe2\x88", "(", "}", ",", ";", " ", "\t", "\n",
+                                           "@", "\xff", "print", "input"};
+  std::mt19937 rng(2025);
+  for (int round = 0; round < 2000; ++round) {
+    std::string random = " "; // analyze() 会把与路径同名的输入（如 "input"）当作文件读取
+    for (int k = rng() % 24; k > 0; --k) random += pieces[rng() % pieces.size()];
+    failed += compare(lexical, random, false);
+  }
+#else
+  std::cout << "未链接生成的词法分析器（lexer_extend），只生成源文件" << std::endl;
+#endif
+
+  std::cout << "错误数: " << failed << std::endl;
+  return failed == 0 ? 0 : 1;
+}
@@ -14,7 +14,6 @@ int main() {
 
   SLRTable slr_table(item_cluster);
   slr_table.build();
-  slr_table.to_csv("output/slr_table/slr_table_extend_before.csv");
 
   // 输出冲突状态
   // slr_table.conflict_to_csv("output/slr_table/conflict_before.csv");
@@ -22,8 +21,8 @@ int main() {
   // 获取文法编号
   // slr_table.id_to_grammar_to_txt("output/slr_table/id_to_grammar.txt");
 
-  // 消除冲突状态
-  slr_table.eliminate_conflict("output/slr_table/conflict_after.csv");
+  // 消除冲突状态：有声明的冲突已在 build() 中消解，这里修正剩余未声明的冲突
+  slr_table.eliminate_conflict(SLR_CONFLICT_EXTEND);
   slr_table.to_csv("output/slr_table/slr_table_extend_after.csv");
   return 0;
 }
@@ -0,0 +1,73 @@
+//
+// 编译后的稠密分析表与 map 形式的 ACTION/GOTO 表逐格对照（含一个未登记的符号 id）
+//
+#include "basic/item.hpp"
+#include "basic/grammar.hpp"
+#include "basic/slr_table.hpp"
+
+// 逐格比较，返回不一致的格子数
+static int compare(const SLRTable& slr_table) {
+  const ParseTable& table = slr_table.compiled();
+  const SymbolInterner& symbols = slr_table.symbols();
+  int mismatch = 0;
+
+  // 缓存的哈希即符号名的哈希（按 id 索引的容器依赖这一点保持输出顺序）
+  for (SymbolId symbol = 0; symbol < static_cast<SymbolId>(symbols.size()); ++symbol) {
+    if (symbols.hash(symbol) != std::hash<std::string>{}(symbols.name(symbol))) mismatch++;
+  }
+
+  for (const auto& [state, row] : slr_table.get_action()) {
+    for (SymbolId symbol = 0; symbol <= static_cast<SymbolId>(symbols.size()); ++symbol) {
+      const auto* actions = slr_table.get_action(state, symbol);
+      ParseTable::Entry entry = table.action(state, symbol);
+      if (!actions || actions->empty()) {
+        if (!ParseTable::is_error(entry)) mismatch++;
+      } else if (actions->size() > 1) {
+        if (!ParseTable::is_conflict(entry) || table.conflict(entry).actions.size() != actions->size()) mismatch++;
+      } else if (!(SLRTable::unpack(entry) == *actions->begin())) {
+        mismatch++;
+      }
+    }
+  }
+
+  for (const auto& [state, row] : slr_table.get_goto()) {
+    for (SymbolId symbol = 0; symbol <= static_cast<SymbolId>(symbols.size()); ++symbol) {
+      const auto* targets = slr_table.get_goto(state, symbol);
+      int target = table.goto_state(state, symbol);
+      if (!targets || targets->empty()) {
+        if (target != -1) mismatch++;
+      } else if (target != *targets->begin()) {
+        mismatch++;
+      }
+    }
+  }
+
+  return mismatch;
+}
+
+int main() {
+  GrammarSet grammar_set(GRAMMAR_EXTEND, "P");
+  ItemCluster item_cluster(grammar_set);
+  item_cluster.build();
+
+  int failed = 0;
+
+  // build() 之后（含冲突）
+  SLRTable built(item_cluster);
+  built.build();
+  failed += compare(built);
+  std::cout << "build: " << built.compiled().state_count() << " 个状态, "
+            << built.compiled().conflicts().size() << " 个冲突格子" << std::endl;
+
+  // eliminate_conflict() 之后
+  built.eliminate_conflict("output/slr_table/conflict_after.csv");
+  failed += compare(built);
+
+  // read_csv() 之后
+  SLRTable loaded(item_cluster);
+  loaded.read_csv(SLR_TABLE_EXTEND);
+  failed += compare(loaded);
+
+  std::cout << "不一致的格子数: " << failed << std::endl;
+  return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,56 @@
+//
+// 压缩分析表（行位移 + 默认归约）与稠密表对照，并输出三种形式的字节数
+//
+#include "basic/item.hpp"
+#include "basic/grammar.hpp"
+#include "basic/slr_table.hpp"
+#include <fstream>
+
+// exact 压缩表必须与稠密表逐格一致；yacc 式压缩表只允许出错格子变成默认归约
+static int compare(const SLRTable& slr_table) {
+  const ParseTable& dense = slr_table.compiled();
+  const CompressedParseTable exact = slr_table.compress(true);
+  const CompressedParseTable yacc = slr_table.compress(false);
+  const auto symbol_count = static_cast<SymbolId>(slr_table.symbols().size());
+  int mismatch = 0;
+
+  for (int state = 0; state < static_cast<int>(dense.state_count()); ++state) {
+    for (SymbolId symbol = -1; symbol <= symbol_count; ++symbol) {
+      ParseTable::Entry expected = dense.action(state, symbol);
+      if (exact.action(state, symbol) != expected) mismatch++;
+
+      ParseTable::Entry loose = yacc.action(state, symbol);
+      if (ParseTable::is_error(expected)) {
+        if (!ParseTable::is_error(loose) && ParseTable::kind(loose) != ParseTable::REDUCE) mismatch++;
+      } else if (loose != expected) {
+        mismatch++;
+      }
+
+      int target = dense.goto_state(state, symbol);
+      if (exact.goto_state(state, symbol) != target) mismatch++;
+      if (target >= 0 && yacc.goto_state(state, symbol) != target) mismatch++;
+    }
+  }
+  return mismatch;
+}
+
+int main() {
+  int failed = 0;
+  for (const auto& [grammar_file, tag] : {std::pair{GRAMMAR_NORMAL, "normal"}, std::pair{GRAMMAR_EXTEND, "extend"}}) {
+    GrammarSet grammar_set(grammar_file, "P");
+    ItemCluster item_cluster(grammar_set);
+    item_cluster.build();
+
+    SLRTable slr_table(item_cluster);
+    slr_table.build();
+    failed += compare(slr_table);
+
+    std::string report = std::string("output/slr_table/table_bytes_") + tag + ".txt";
+    slr_table.table_bytes_to_txt(report);
+    std::ifstream in(report);
+    std::cout << grammar_file << ":\n" << in.rdbuf() << std::endl;
+  }
+
+  std::cout << "不一致的格子数: " << failed << std::endl;
+  return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,54 @@
+//
+// LALR(1) 构建：向前看符号是 FOLLOW 集的子集，冲突数不多于 SLR
+//
+#include "basic/item.hpp"
+#include "basic/grammar.hpp"
+#include "basic/slr_table.hpp"
+
+// LALR 表的每个动作都必须出现在 SLR 表的同一格子里
+static int compare(const SLRTable& slr, const SLRTable& lalr) {
+  int mismatch = 0;
+  for (const auto& [state, row] : lalr.get_action()) {
+    for (const auto& [symbol, actions] : row) {
+      const SLRTable::ActionSet* expected = slr.get_action(state, symbol);
+      for (const auto& action : actions) {
+        if (expected == nullptr || !expected->count(action)) {
+          std::cerr << "状态 " << state << " 在 " << symbol << " 上多出动作 " << action << std::endl;
+          mismatch++;
+        }
+      }
+    }
+  }
+  return mismatch;
+}
+
+static int run(const std::string& name, const GrammarSet& grammar_set, bool expect_lalr_clean) {
+  ItemCluster item_cluster(grammar_set);
+  item_cluster.build();
+
+  SLRTable slr(item_cluster);
+  slr.build();
+
+  SLRTable lalr(item_cluster);
+  lalr.set_method(SLRTable::LALR);
+  lalr.build();
+
+  std::cout << name << ": SLR 冲突 " << slr.conflicts().size()
+            << ", LALR(1) 冲突 " << lalr.conflicts().size() << std::endl;
+
+  int failed = compare(slr, lalr);
+  if (lalr.conflicts().size() > slr.conflicts().size()) failed++;
+  if (expect_lalr_clean && !lalr.conflicts().empty()) failed++;
+  return failed;
+}
+
+int main() {
+  int failed = 0;
+  // 经典的 LALR(1) 而非 SLR(1) 文法：SLR 在 '=' 上有移进-归约冲突
+  failed += run("S -> L = R | R", GrammarSet("S -> L = R | R\nL -> * R | id\nR -> L", "S"), true);
+  failed += run(GRAMMAR_NORMAL, GrammarSet(GRAMMAR_NORMAL, "P"), false);
+  failed += run(GRAMMAR_EXTEND, GrammarSet(GRAMMAR_EXTEND, "P"), false);
+
+  std::cout << "错误数: " << failed << std::endl;
+  return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,68 @@
+//
+// SLR / LALR(1) / 规范 LR(1) / Pager 合并 LR(1)：构建时间、状态数和冲突数
+//
+#include "basic/item.hpp"
+#include "basic/grammar.hpp"
+#include "basic/slr_table.hpp"
+#include <chrono>
+#include <iomanip>
+
+struct Report {
+  double ms;
+  size_t states;
+  size_t conflicts;
+};
+
+static Report build(const ItemCluster& item_cluster, SLRTable::Method method) {
+  auto begin = std::chrono::steady_clock::now();
+  SLRTable table(item_cluster);
+  table.set_method(method);
+  table.build();
+  double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+  return {ms, table.id_to_state().size(), table.conflicts().size()};
+}
+
+static int run(const std::string& name, const GrammarSet& grammar_set, bool lr1_clean) {
+  // 构建 ItemCluster 也算进 LR(0) 系的时间
+  auto begin = std::chrono::steady_clock::now();
+  ItemCluster item_cluster(grammar_set);
+  item_cluster.build();
+  double lr0_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+  const char* names[] = {"SLR", "LALR(1)", "LR(1)", "Pager"};
+  Report reports[4];
+  for (int method = SLRTable::SLR; method <= SLRTable::PAGER; ++method) {
+    reports[method] = build(item_cluster, static_cast<SLRTable::Method>(method));
+  }
+  reports[SLRTable::SLR].ms += lr0_ms;
+  reports[SLRTable::LALR].ms += lr0_ms;
+
+  std::cout << name << ":\n";
+  for (int method = SLRTable::SLR; method <= SLRTable::PAGER; ++method) {
+    std::cout << "  " << std::left << std::setw(8) << names[method]
+              << std::right << std::setw(10) << std::fixed << std::setprecision(2) << reports[method].ms << " ms"
+              << std::setw(8) << reports[method].states << " 个状态"
+              << std::setw(6) << reports[method].conflicts << " 个冲突" << std::endl;
+  }
+
+  int failed = 0;
+  // 合并后的状态数不超过规范 LR(1)，冲突不多于 LALR(1)
+  if (reports[SLRTable::PAGER].states > reports[SLRTable::LR1].states) failed++;
+  if (reports[SLRTable::PAGER].conflicts > reports[SLRTable::LALR].conflicts) failed++;
+  // 规范 LR(1) 无冲突时合并后也无冲突
+  if (reports[SLRTable::LR1].conflicts == 0 && reports[SLRTable::PAGER].conflicts != 0) failed++;
+  if (lr1_clean && reports[SLRTable::LR1].conflicts != 0) failed++;
+  return failed;
+}
+
+int main() {
+  int failed = 0;
+  // LR(1) 而非 LALR(1) 的文法：合并同核状态 [E -> e •, F -> e •] 会产生归约-归约冲突
+  failed += run("S -> a E c | a F d | b F c | b E d",
+                GrammarSet("S -> a E c | a F d | b F c | b E d\nE -> e\nF -> e", "S"), true);
+  failed += run(GRAMMAR_NORMAL, GrammarSet(GRAMMAR_NORMAL, "P"), false);
+  failed += run(GRAMMAR_EXTEND, GrammarSet(GRAMMAR_EXTEND, "P"), false);
+
+  std::cout << "错误数: " << failed << std::endl;
+  return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,82 @@
+//
+// 文法中的 %left / %right / %nonassoc 声明：build() 按声明消解冲突，未声明的冲突保留，
+// 再用手工修正的 CSV 消解剩余冲突后与手工消解的分析表一致
+//
+#include "basic/item.hpp"
+#include "basic/grammar.hpp"
+#include "basic/slr_table.hpp"
+
+// 逐格比较两张表的 ACTION，返回不一致的格子数
+static int compare(const SLRTable& built, const SLRTable& expected) {
+  const SymbolInterner& symbols = built.symbols();
+  int mismatch = 0;
+  for (const auto& [state, row] : expected.get_action()) {
+    for (const auto& [symbol, actions] : row) {
+      const auto* found = built.get_action(state, symbol);
+      if (!found || *found != actions) mismatch++;
+    }
+  }
+  for (const auto& [state, row] : built.get_action()) {
+    for (SymbolId symbol = 0; symbol < static_cast<SymbolId>(symbols.size()); ++symbol) {
+      if (built.get_action(state, symbol) && !expected.get_action(state, symbols.name(symbol))) mismatch++;
+    }
+  }
+  return mismatch;
+}
+
+// 状态 state 在 symbol 下的唯一动作，没有或有冲突时返回 {ERROR, -1}
+static SLRTable::Action single(const SLRTable& table, int state, const std::string& symbol) {
+  const auto* actions = table.get_action(state, symbol);
+  if (!actions || actions->size() != 1) return {SLRTable::ERROR, -1};
+  return *actions->begin();
+}
+
+// E -> E op E | i：输入 "i op i" 之后在 op 上应当执行的动作类型
+static SLRTable::ActionType decide(const std::string& declaration, const std::string& op) {
+  GrammarSet grammar_set(declaration + "\nE -> E " + op + " E | i", "E");
+  ItemCluster item_cluster(grammar_set);
+  item_cluster.build();
+  SLRTable table(item_cluster);
+  table.build();
+
+  // 0 -E-> s1 -op-> s2 -E-> s3：在 s3 读到 op
+  int state = *table.get_goto(0, "E")->begin();
+  state = single(table, state, op).target;
+  state = *table.get_goto(state, "E")->begin();
+  return single(table, state, op).type;
+}
+
+int main() {
+  int failed = 0;
+
+  GrammarSet grammar_set(GRAMMAR_EXTEND, "P");
+  ItemCluster item_cluster(grammar_set);
+  item_cluster.build();
+
+  SLRTable built(item_cluster);
+  built.build();
+  SLRTable expected(item_cluster);
+  expected.read_csv(SLR_TABLE_EXTEND);
+
+  // 未声明优先级的两个格子：空实参表后的 ) 与悬空 else
+  const size_t remaining = built.conflicts().size();
+  if (remaining != 2) failed++;
+  if (single(built, 82, ")").type != SLRTable::ERROR) failed++;
+  if (single(built, 81, "else").type != SLRTable::ERROR) failed++;
+
+  built.eliminate_conflict(SLR_CONFLICT_EXTEND);
+  int mismatch = compare(built, expected);
+  std::cout << "与 " << SLR_TABLE_EXTEND << " 不一致的格子数: " << mismatch
+            << "    保留冲突数: " << remaining << std::endl;
+  failed += mismatch;
+
+  // 结合性
+  if (decide("%left +", "+") != SLRTable::REDUCE) failed++;
+  if (decide("%right =", "=") != SLRTable::SHIFT) failed++;
+  if (decide("%nonassoc <", "<") != SLRTable::ERROR) failed++;
+  // 没有声明：保留冲突，不默认移进
+  if (decide("%left -", "+") != SLRTable::ERROR) failed++;
+
+  std::cout << "错误数: " << failed << std::endl;
+  return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,126 @@
+//
+// 二进制分析表：保存后映射加载，与 build() 的结果逐格对照（复制后的表也一样）；
+// 文法改动、文件截断或内容损坏（偏移不单调、目标越界）时拒绝加载
+//
+#include "basic/item.hpp"
+#include "basic/grammar.hpp"
+#include "basic/slr_table.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+// 二进制分析表文件头的长度，其后是名字偏移
+static constexpr size_t NAME_OFFSETS = 72;
+
+static double elapsed_ms(std::chrono::steady_clock::time_point begin) {
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+}
+
+// 逐格比较编译后的分析表和产生式、状态，返回不一致的项数
+static int compare(const SLRTable& built, const SLRTable& loaded) {
+  const ParseTable& a = built.compiled();
+  const ParseTable& b = loaded.compiled();
+  int mismatch = 0;
+  if (a.state_count() != b.state_count() || a.actions() != b.actions() || a.gotos() != b.gotos()) mismatch++;
+  if (a.terminals() != b.terminals() || a.non_terminals() != b.non_terminals()) mismatch++;
+  if (built.start_state() != loaded.start_state() || built.final_accept_state() != loaded.final_accept_state() ||
+      built.accept_states() != loaded.accept_states()) mismatch++;
+  if (built.id_to_state() != loaded.id_to_state() || built.conflicts().size() != loaded.conflicts().size()) mismatch++;
+
+  for (SymbolId id = 0; id < static_cast<SymbolId>(built.symbols().size()); ++id) {
+    if (built.symbols().name(id) != loaded.symbols().name(id)) mismatch++;
+  }
+  for (const auto& [id, grammar] : built.id_to_grammar()) {
+    const Grammar other = loaded.find_grammar(id);
+    if (!(grammar == other) || grammar.lhs_id() != other.lhs_id() || grammar.rhs_ids() != other.rhs_ids()) mismatch++;
+  }
+  for (const auto& [state, row] : built.get_action()) {
+    for (const auto& [symbol, actions] : row) {
+      const auto* found = loaded.get_action(state, symbol);
+      if (!found || *found != actions) mismatch++;
+    }
+  }
+  return mismatch;
+}
+
+int main() {
+  int failed = 0;
+
+  auto begin = std::chrono::steady_clock::now();
+  GrammarSet grammar_set(GRAMMAR_EXTEND, "P");
+  ItemCluster item_cluster(grammar_set);
+  item_cluster.build();
+  SLRTable built(item_cluster);
+  built.build();
+  built.eliminate_conflict(SLR_CONFLICT_EXTEND);
+  const double build_ms = elapsed_ms(begin);
+  built.to_binary(SLR_TABLE_EXTEND_BINARY);
+
+  begin = std::chrono::steady_clock::now();
+  SLRTable loaded;
+  if (!loaded.read_binary(SLR_TABLE_EXTEND_BINARY, GRAMMAR_EXTEND)) failed++;
+  const double load_ms = elapsed_ms(begin);
+
+  const int mismatch = compare(built, loaded);
+  failed += mismatch;
+  std::cout << "build: " << build_ms << " ms    read_binary: " << load_ms << " ms    不一致: " << mismatch << std::endl;
+
+  // 原表销毁后，复制出的表仍引用同一映射，延迟还原的 map 形式的表也一致
+  SLRTable copied;
+  {
+    SLRTable source;
+    if (!source.read_binary(SLR_TABLE_EXTEND_BINARY, GRAMMAR_EXTEND)) failed++;
+    copied = source;
+  }
+  failed += compare(built, copied);
+
+  // 加载后再保存，文件内容不变
+  loaded.to_binary("output/slr_table/slr_table_extend_copy.bin");
+  std::ifstream first(SLR_TABLE_EXTEND_BINARY, std::ios::binary), second("output/slr_table/slr_table_extend_copy.bin", std::ios::binary);
+  if (std::string(std::istreambuf_iterator<char>(first), {}) != std::string(std::istreambuf_iterator<char>(second), {})) failed++;
+
+  // 文法改动后拒绝加载
+  std::ifstream grammar_file(GRAMMAR_EXTEND);
+  std::string grammar_text(std::istreambuf_iterator<char>(grammar_file), {});
+  SLRTable stale;
+  if (stale.read_binary(SLR_TABLE_EXTEND_BINARY, grammar_text + "T -> double\n")) failed++;
+  if (!stale.compiled().empty()) failed++;
+  if (!stale.read_binary(SLR_TABLE_EXTEND_BINARY, grammar_text)) failed++;
+
+  // 截断的文件
+  std::ifstream whole(SLR_TABLE_EXTEND_BINARY, std::ios::binary);
+  std::string bytes(std::istreambuf_iterator<char>(whole), {});
+  std::ofstream("output/slr_table/slr_table_extend_copy.bin", std::ios::binary) << bytes.substr(0, bytes.size() / 2);
+  SLRTable truncated;
+  if (truncated.read_binary("output/slr_table/slr_table_extend_copy.bin", GRAMMAR_EXTEND)) failed++;
+
+  // 内容损坏：名字偏移不单调
+  std::string shuffled = bytes;
+  const uint32_t bad_offset = 0xfffffff0u;
+  std::memcpy(&shuffled[NAME_OFFSETS + 4], &bad_offset, sizeof(bad_offset));
+  std::ofstream("output/slr_table/slr_table_extend_copy.bin", std::ios::binary) << shuffled;
+  SLRTable corrupted;
+  if (corrupted.read_binary("output/slr_table/slr_table_extend_copy.bin", GRAMMAR_EXTEND)) failed++;
+
+  // 内容损坏：移进、GOTO 目标超出状态数，归约超出产生式数
+  const int state_count = static_cast<int>(built.compiled().state_count());
+  const int production_count = static_cast<int>(built.production_count());
+  for (int k = 0; k < 3; ++k) {
+    SLRTable bad = built;
+    if (k == 0) bad.set_action(0, "int", SLRTable::SHIFT, state_count);
+    if (k == 1) bad.set_action(0, "int", SLRTable::REDUCE, production_count);
+    if (k == 2) bad.set_goto(0, "P", state_count + 5);
+    bad.compile();
+    bad.to_binary("output/slr_table/slr_table_extend_copy.bin");
+    SLRTable rejected;
+    if (rejected.read_binary("output/slr_table/slr_table_extend_copy.bin", GRAMMAR_EXTEND) || !rejected.compiled().empty()) {
+      std::cerr << "越界的目标 " << k << " 没有被拒绝" << std::endl;
+      failed++;
+    }
+  }
+  std::remove("output/slr_table/slr_table_extend_copy.bin");
+
+  std::cout << "错误数: " << failed << std::endl;
+  return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,46 @@
+//
+// constexpr 分析表头文件：生成头文件；basic 以 SLR_TABLE_GENERATED=ON 编译时，装入编译进来的表并与 build() 对照
+//
+#include "basic/item.hpp"
+#include "basic/grammar.hpp"
+#include "basic/slr_table.hpp"
+#include <chrono>
+#include <fstream>
+
+int main() {
+  int failed = 0;
+
+  GrammarSet grammar_set(GRAMMAR_EXTEND, "P");
+  ItemCluster item_cluster(grammar_set);
+  item_cluster.build();
+  SLRTable built(item_cluster);
+  built.build();
+  built.eliminate_conflict(SLR_CONFLICT_EXTEND);
+  built.to_header("output/slr_table/slr_table_extend.hpp");
+
+  std::ifstream header("output/slr_table/slr_table_extend.hpp");
+  std::string text(std::istreambuf_iterator<char>(header), {});
+  if (text.find("inline constexpr SLRTable::Image slr_table = {") == std::string::npos) failed++;
+
+  auto begin = std::chrono::steady_clock::now();
+  SLRTable generated;
+  if (!generated.load_generated()) {
+    std::cout << "basic 未编译生成的分析表（SLR_TABLE_GENERATED=OFF），只检查头文件" << std::endl;
+  } else {
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    int mismatch = 0;
+    if (generated.grammar_checksum() != GrammarSet::checksum(GRAMMAR_EXTEND)) mismatch++;
+    if (generated.compiled().actions() != built.compiled().actions() ||
+        generated.compiled().gotos() != built.compiled().gotos()) mismatch++;
+    if (generated.start_state() != built.start_state() || generated.accept_states() != built.accept_states()) mismatch++;
+    for (const auto& [id, grammar] : built.id_to_grammar()) {
+      const Grammar other = generated.find_grammar(id);
+      if (!(grammar == other) || grammar.rhs_ids() != other.rhs_ids()) mismatch++;
+    }
+    std::cout << "load_generated: " << ms << " ms    不一致: " << mismatch << std::endl;
+    failed += mismatch;
+  }
+
+  std::cout << "错误数: " << failed << std::endl;
+  return failed == 0 ? 0 : 1;
+}
@@ -15,18 +15,12 @@ int main() {
   auto tokens = lexical.analyze(program_file);
   lexical.to_txt("output/lexical/lexical.txt");
 
-  // 文法集
-  GrammarSet grammar_set(GRAMMAR_EXTEND, "P");
-  ItemCluster item_cluster(grammar_set);
-  item_cluster.build();
-
-  // SLR分析表
-  SLRTable slr_table(item_cluster);
-  slr_table.read_csv(SLR_TABLE_EXTEND);
+  // SLR分析表：优先映射二进制分析表，没有或文法已修改时重新构建并保存
+  const SLRTable slr_table = SLRTable::load_or_build(SLR_TABLE_EXTEND_BINARY, GRAMMAR_EXTEND, "P", SLR_CONFLICT_EXTEND, true);
 
   // 符号表分析
   SyntaxZyl syntax(slr_table);
-  syntax.parse(tokens);
+  syntax.parse(tokens, lexical);
   syntax.symbol_table_to_txt("output/symbol_table/symbol_table.txt");
 
   // 代码输出
@@ -0,0 +1,139 @@
+//
+// 语义值的分配次数：把 program_01 放大（函数改名后复制多份），统计 SyntaxZyl::parse() 期间的堆分配次数和耗时
+//
+#include "syntax.hpp"
+#include "basic/slr_table.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <regex>
+#include <sstream>
+
+// 替换全部全局 operator new/delete（含数组、nothrow、按大小和对齐的版本），统计堆分配次数
+static size_t allocations = 0;
+
+// 释放函数不能内联进调用处，否则 GCC 看到 operator new 的结果交给 free，报 -Wmismatched-new-delete
+#if defined(__GNUC__)
+#define NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+#define NOINLINE __declspec(noinline)
+#else
+#define NOINLINE
+#endif
+
+static void* counted_alloc(size_t size) {
+  allocations++;
+  return std::malloc(size ? size : 1);
+}
+
+static void* counted_alloc(size_t size, std::align_val_t align) {
+  allocations++;
+  const size_t alignment = static_cast<size_t>(align);
+  size = (size + alignment - 1) / alignment * alignment;
+#ifdef _WIN32
+  return _aligned_malloc(size ? size : alignment, alignment);
+#else
+  return std::aligned_alloc(alignment, size ? size : alignment);
+#endif
+}
+
+NOINLINE static void counted_free(void* p) noexcept { std::free(p); }
+
+NOINLINE static void counted_free(void* p, std::align_val_t) noexcept {
+#ifdef _WIN32
+  _aligned_free(p);
+#else
+  std::free(p);
+#endif
+}
+
+void* operator new(size_t size) {
+  if (void* p = counted_alloc(size)) return p;
+  throw std::bad_alloc();
+}
+void* operator new[](size_t size) {
+  if (void* p = counted_alloc(size)) return p;
+  throw std::bad_alloc();
+}
+void* operator new(size_t size, std::align_val_t align) {
+  if (void* p = counted_alloc(size, align)) return p;
+  throw std::bad_alloc();
+}
+void* operator new[](size_t size, std::align_val_t align) {
+  if (void* p = counted_alloc(size, align)) return p;
+  throw std::bad_alloc();
+}
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return counted_alloc(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return counted_alloc(size); }
+void* operator new(size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { return counted_alloc(size, align); }
+void* operator new[](size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { return counted_alloc(size, align); }
+
+void operator delete(void* p) noexcept { counted_free(p); }
+void operator delete[](void* p) noexcept { counted_free(p); }
+void operator delete(void* p, size_t) noexcept { counted_free(p); }
+void operator delete[](void* p, size_t) noexcept { counted_free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { counted_free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { counted_free(p); }
+void operator delete(void* p, std::align_val_t align) noexcept { counted_free(p, align); }
+void operator delete[](void* p, std::align_val_t align) noexcept { counted_free(p, align); }
+void operator delete(void* p, size_t, std::align_val_t align) noexcept { counted_free(p, align); }
+void operator delete[](void* p, size_t, std::align_val_t align) noexcept { counted_free(p, align); }
+void operator delete(void* p, std::align_val_t align, const std::nothrow_t&) noexcept { counted_free(p, align); }
+void operator delete[](void* p, std::align_val_t align, const std::nothrow_t&) noexcept { counted_free(p, align); }
+
+// 放大的 program_01：全局声明一份，函数 q/p（及内层 r）改名为 q_k/p_k/r_k 复制 copies 份，最后逐个调用
+// 文法只有一维数组，原程序中的 a[2, 3] 和 a[1, 2] 改为一维
+static std::string scale_program(const std::string& program, int copies) {
+  std::string text = std::regex_replace(program, std::regex(R"(a\[2, 3\])"), "a[6]");
+  text = std::regex_replace(text, std::regex(R"(a\[1, 2\])"), "a[5]");
+
+  const size_t functions = text.find("void q");
+  const size_t statements = text.find("x = 15;");
+  const std::string globals = text.substr(0, functions);
+  const std::string body = text.substr(functions, statements - functions);
+
+  std::string scaled = globals;
+  for (int k = 0; k < copies; ++k) {
+    scaled += std::regex_replace(body, std::regex(R"(\b([qpr])\b)"), "$1_" + std::to_string(k));
+  }
+  scaled += "x = 15;\na[5] = 21;\n";
+  for (int k = 0; k < copies; ++k) {
+    scaled += "p_" + std::to_string(k) + "()" + (k + 1 < copies ? ";\n" : "\n");
+  }
+  return scaled;
+}
+
+int main() {
+  const SLRTable slr_table = SLRTable::load_or_build(SLR_TABLE_EXTEND_BINARY, GRAMMAR_EXTEND, "P", SLR_CONFLICT_EXTEND);
+
+  std::ifstream in(index_format("input/program/program", 1, ".txt"));
+  std::stringstream buffer;
+  buffer << in.rdbuf();
+  const std::string text = scale_program(buffer.str(), 2000);
+
+  Lexical lexical(LEXICAL_EXTEND);
+  const std::vector<Lexical::Token> tokens = lexical.analyze(text);
+
+  int failed = 0;
+  SyntaxZyl syntax(slr_table);
+  syntax.set_record_processes(false);
+
+  const size_t before = allocations;
+  auto begin = std::chrono::steady_clock::now();
+  if (!syntax.parse(tokens, lexical)) failed++;
+  double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+  const size_t count = allocations - before;
+
+  std::cout << tokens.size() << " 个记号: " << count << " 次堆分配（每记号 " << static_cast<double>(count) / tokens.size()
+            << "）, " << ms << " ms" << std::endl;
+
+  // 每份函数都应登记到符号表中
+  if (syntax.symbol_table().count("p_1999@system_table") == 0) {
+    std::cout << "符号表中没有 p_1999" << std::endl;
+    failed++;
+  }
+
+  std::cout << "错误数: " << failed << std::endl;
+  return failed == 0 ? 0 : 1;
+}
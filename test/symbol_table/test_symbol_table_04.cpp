@@ -0,0 +1,85 @@
+//
+// 代码属性用 CodeRope 拼接：长语句表和深层嵌套下语义分析的耗时应随规模线性增长，展开的代码与逐条拼接一致
+//
+#include "syntax.hpp"
+#include "basic/slr_table.hpp"
+#include <algorithm>
+#include <chrono>
+
+// 分析 text，返回耗时（毫秒），code 为全局作用域展开后的代码
+static double parse(const SLRTable& slr_table, const std::string& text, std::string& code, int& failed) {
+  Lexical lexical(LEXICAL_EXTEND);
+  const std::vector<Lexical::Token> tokens = lexical.analyze(text);
+
+  SyntaxZyl syntax(slr_table);
+  syntax.set_record_processes(false);
+  auto begin = std::chrono::steady_clock::now();
+  if (!syntax.parse(tokens, lexical)) failed++;
+  double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+  code = tac_to_string(syntax.symbol_table().at("system_table")->code);
+  return ms;
+}
+
+// n 条赋值语句
+static std::string statements(int n) {
+  std::string text = "int x;\n";
+  for (int i = 0; i < n; ++i) {
+    text += "x = x + 1";
+    text += i + 1 < n ? ";\n" : "\n";
+  }
+  return text;
+}
+
+// depth 层嵌套的 while
+static std::string nested(int depth) {
+  std::string text = "int x;\n";
+  for (int i = 0; i < depth; ++i) {
+    text += "while (x < 10) ";
+  }
+  return text + "x = x + 1\n";
+}
+
+int main() {
+  int failed = 0;
+
+  // CodeRope 本身：拼接顺序、共享子串、空代码
+  CodeRope a = TacInstruction::label(TacOperand::label("a"));
+  CodeRope b = a + TacInstruction::jump(TacOperand::label("b"));
+  CodeRope c = b + b;
+  c += CodeRope();
+  if (c.str() != "LABEL a;\nGOTO b;\nLABEL a;\nGOTO b;\n" || b.str() != "LABEL a;\nGOTO b;\n" || c.size() != 4 ||
+      !CodeRope().empty()) failed++;
+  TacCode unrolled = c.instructions();
+  if (unrolled.size() != 4 || unrolled[3].op != TacOp::GOTO || unrolled[3].target != TacOperand::label("b")) failed++;
+
+  // 很长的拼接链：展开和析构都不能递归
+  const TacInstruction x = TacInstruction::assign(TacOperand::variable("x"), TacOperand::constant("1"));
+  CodeRope chain;
+  for (int i = 0; i < 1000000; ++i) chain += x;
+  if (chain.size() != 1000000 || chain.instructions().size() != 1000000) failed++;
+  chain = CodeRope();
+
+  const SLRTable slr_table = SLRTable::load_or_build(SLR_TABLE_EXTEND_BINARY, GRAMMAR_EXTEND, "P", SLR_CONFLICT_EXTEND);
+
+  // 每条 x = x + 1 生成 3 行三地址代码
+  std::string code;
+  const double small_list = parse(slr_table, statements(20000), code, failed);
+  if (std::count(code.begin(), code.end(), '\n') != 3 * 20000) failed++;
+  const double large_list = parse(slr_table, statements(80000), code, failed);
+  if (std::count(code.begin(), code.end(), '\n') != 3 * 80000) failed++;
+  std::cout << "语句表 20000 / 80000 条: " << small_list << " ms / " << large_list << " ms（比值 "
+            << large_list / small_list << "）" << std::endl;
+
+  // 每层 while 生成一条 GOTO
+  const double small_nest = parse(slr_table, nested(2000), code, failed);
+  const double large_nest = parse(slr_table, nested(8000), code, failed);
+  size_t gotos = 0;
+  for (size_t pos = code.find("GOTO"); pos != std::string::npos; pos = code.find("GOTO", pos + 1)) gotos++;
+  if (gotos != 8000) failed++;
+  std::cout << "嵌套 while 2000 / 8000 层: " << small_nest << " ms / " << large_nest << " ms（比值 "
+            << large_nest / small_nest << "）" << std::endl;
+
+  std::cout << "错误数: " << failed << std::endl;
+  return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,65 @@
+//
+// 语义分析直接生成结构化的三地址指令：检查操作码、操作数种类，以及打印出的文本与原先的文本代码一致；
+// 按记号类型 id 查文法符号与按类型字符串查找的分析结果相同
+//
+#include "syntax.hpp"
+#include "basic/slr_table.hpp"
+
+int main() {
+  int failed = 0;
+
+  const SLRTable slr_table = SLRTable::load_or_build(SLR_TABLE_EXTEND_BINARY, GRAMMAR_EXTEND, "P", SLR_CONFLICT_EXTEND);
+
+  const std::string text =
+    "int a[10];\n"
+    "int x;\n"
+    "input x;\n"
+    "a[x] = x * 2;\n"
+    "while (x) x = a[x] - 1;\n"
+    "print x\n";
+  Lexical lexical(LEXICAL_EXTEND);
+  const std::vector<Lexical::Token> tokens = lexical.analyze(text);
+  SyntaxZyl syntax(slr_table);
+  if (!syntax.parse(tokens, lexical)) failed++;
+
+  const TacCode& code = syntax.symbol_table().at("system_table")->code;
+  const std::string expected =
+    "INPUT x;\n"
+    "t0 = 2;\n"
+    "t1 = x * t0;\n"
+    "a[x] = t1;\n"
+    "LABEL l2;\n"
+    "IF x != 0 THEN l0 ELSE l1;\n"
+    "LABEL l0;\n"
+    "t2 = a[x];\n"
+    "t3 = 1;\n"
+    "t4 = t2 - t3;\n"
+    "x = t4;\n"
+    "GOTO l2;\n"
+    "LABEL l1;\n"
+    "PRINT x;\n";
+  if (tac_to_string(code) != expected) {
+    std::cerr << tac_to_string(code);
+    failed++;
+  }
+
+  SyntaxZyl by_name(slr_table);
+  if (!by_name.parse(tokens) || tac_to_string(by_name.symbol_table().at("system_table")->code) != expected) failed++;
+
+  // 操作数保留了种类，后续的遍不需要再解析文本
+  if (code.size() != 14) {
+    failed++;
+  } else {
+    if (code[0].op != TacOp::INPUT || code[0].dst != TacOperand::variable("x")) failed++;
+    if (code[1].op != TacOp::ASSIGN || code[1].src1.kind != TacOperand::CONSTANT) failed++;
+    if (code[2].op != TacOp::BINARY || code[2].oper != "*" || code[2].dst.kind != TacOperand::TEMP) failed++;
+    if (code[3].op != TacOp::STORE_ARRAY || code[3].dst != TacOperand::variable("a")) failed++;
+    if (code[5].op != TacOp::IF || code[5].target != TacOperand::label("l0") ||
+        code[5].alternative != TacOperand::label("l1")) failed++;
+    if (code[7].op != TacOp::LOAD_ARRAY || code[7].src2 != TacOperand::variable("x")) failed++;
+    if (code[11].op != TacOp::GOTO || code[11].target.kind != TacOperand::LABEL) failed++;
+  }
+
+  std::cout << "错误数: " << failed << std::endl;
+  return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,21 @@
+//
+// 词法分析器生成器：把词法规则 JSON 生成为 switch/goto 状态机的 C++ 源文件
+// 用法: lexer_gen <词法规则 JSON> <输出 .cpp> <输出 .hpp> [名字]
+//
+#include "basic/lexical.hpp"
+#include <iostream>
+
+int main(int argc, char* argv[]) {
+  if (argc < 4) {
+    std::cerr << "用法: " << argv[0] << " <词法规则 JSON> <输出 .cpp> <输出 .hpp> [名字]" << std::endl;
+    return 1;
+  }
+  const std::string name = argc > 4 ? argv[4] : "lexer";
+
+  Lexical lexical(argv[1]);
+  if (lexical.engine() != Lexical::Engine::DFA) {
+    std::cerr << "[lexer_gen] 规则无法编译为 DFA: " << argv[1] << std::endl;
+    return 1;
+  }
+  return lexical.to_cpp(argv[2], argv[3], name) ? 0 : 1;
+}
@@ -0,0 +1,39 @@
+//
+// 分析表生成器：构建 SLR 分析表并输出为 constexpr 数组的头文件
+// 用法: slr_table_gen <输出头文件> [文法文件] [起始符号] [冲突修正CSV]
+// 在仓库根目录下运行（默认文法为 input/grammar/grammar_extend.txt，起始符号 P，
+// 冲突修正为 output/slr_table/conflict_after.csv；指定文法时默认不修正）
+//
+#include "basic/item.hpp"
+#include "basic/grammar.hpp"
+#include "basic/slr_table.hpp"
+
+int main(int argc, char* argv[]) {
+  if (argc < 2) {
+    std::cerr << "用法: " << argv[0] << " <输出头文件> [文法文件] [起始符号] [冲突修正CSV]" << std::endl;
+    return 1;
+  }
+  const std::string output = argv[1];
+  const std::string grammar = argc > 2 ? argv[2] : GRAMMAR_EXTEND;
+  const std::string start = argc > 3 ? argv[3] : "P";
+  const std::string fix = argc > 4 ? argv[4] : (argc > 2 ? "" : SLR_CONFLICT_EXTEND);
+
+  GrammarSet grammar_set(grammar, start);
+  if (grammar_set.grammars().empty()) {
+    std::cerr << "[slr_table_gen] 文法为空: " << grammar << std::endl;
+    return 1;
+  }
+  ItemCluster item_cluster(grammar_set);
+  item_cluster.build();
+
+  SLRTable slr_table(item_cluster);
+  slr_table.build();
+  if (!fix.empty() && !slr_table.conflicts().empty()) {
+    slr_table.eliminate_conflict(fix);
+  }
+  if (!slr_table.conflicts().empty()) {
+    std::cerr << "[slr_table_gen] 分析表仍有 " << slr_table.conflicts().size() << " 个冲突格子" << std::endl;
+  }
+  slr_table.to_header(output);
+  return 0;
+}
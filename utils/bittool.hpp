@@ -0,0 +1,102 @@
+#ifndef BITTOOL_HPP
+#define BITTOOL_HPP
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// 位集工具函数集合（FIRST/FOLLOW、向前看符号、闭包模板等按下标的集合）
+namespace bittool {
+
+  using Bits = std::vector<uint64_t>;
+
+  // 能容纳 n 个下标的空位集
+  inline Bits make(size_t n) {
+    return Bits((n + 63) / 64, 0);
+  }
+
+  inline void set(Bits& bits, size_t i) {
+    bits[i / 64] |= uint64_t(1) << (i % 64);
+  }
+
+  inline bool test(const Bits& bits, size_t i) {
+    return i / 64 < bits.size() && (bits[i / 64] >> (i % 64)) & 1;
+  }
+
+  // dst |= src，返回 dst 是否变化
+  inline bool merge(Bits& dst, const Bits& src) {
+    bool changed = false;
+    for (size_t w = 0; w < src.size() && w < dst.size(); ++w) {
+      uint64_t merged = dst[w] | src[w];
+      if (merged != dst[w]) {
+        dst[w] = merged;
+        changed = true;
+      }
+    }
+    return changed;
+  }
+
+  // 是否有公共元素
+  inline bool intersects(const Bits& a, const Bits& b) {
+    for (size_t w = 0; w < a.size() && w < b.size(); ++w) {
+      if (a[w] & b[w]) return true;
+    }
+    return false;
+  }
+
+  // a 是否是 b 的子集
+  inline bool subset(const Bits& a, const Bits& b) {
+    for (size_t w = 0; w < a.size(); ++w) {
+      if (a[w] & ~(w < b.size() ? b[w] : 0)) return false;
+    }
+    return true;
+  }
+
+  // 按下标升序访问每个元素
+  template <typename F>
+  inline void for_each(const Bits& bits, F f) {
+    for (size_t w = 0; w < bits.size(); ++w) {
+      for (uint64_t word = bits[w]; word != 0; word &= word - 1) {
+        f(w * 64 + __builtin_ctzll(word));
+      }
+    }
+  }
+
+  // DeRemer–Pennello 的 Digraph 算法：sets[x] |= sets[y]（x 沿 edges 可达 y），
+  // 按强连通分量处理，分量内所有结点得到相同的集合，每条边只处理一次
+  inline void digraph(const std::vector<std::vector<int>>& edges, std::vector<Bits>& sets) {
+    const size_t n = edges.size();
+    std::vector<int> depth(n, 0);
+    std::vector<int> stack;
+
+    std::function<void(int)> traverse = [&](int x) {
+      stack.push_back(x);
+      const int d = static_cast<int>(stack.size());
+      depth[x] = d;
+      for (int y : edges[x]) {
+        if (depth[y] == 0) traverse(y);
+        depth[x] = std::min(depth[x], depth[y]);
+        merge(sets[x], sets[y]);
+      }
+      // x 是强连通分量的根
+      if (depth[x] == d) {
+        while (true) {
+          int top = stack.back();
+          stack.pop_back();
+          depth[top] = INT_MAX;
+          if (top == x) break;
+          sets[top] = sets[x];
+        }
+      }
+    };
+
+    for (size_t x = 0; x < n; ++x) {
+      if (depth[x] == 0) traverse(static_cast<int>(x));
+    }
+  }
+
+} // namespace bittool
+
+#endif // BITTOOL_HPP
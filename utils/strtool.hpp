@@ -1,6 +1,7 @@
 #ifndef STRTOOL_HPP
 #define STRTOOL_HPP
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <sstream>
@@ -70,6 +71,15 @@ namespace strtool {
     throw std::out_of_range("未找到第 " + std::to_string(k) + " 个数字");
   }
 
+  // 64 位 FNV-1a 哈希，hash 为上一段的结果时可以分段累计
+  inline uint64_t fnv1a(const std::string& s, uint64_t hash = 14695981039346656037ull) {
+    for (unsigned char ch : s) {
+      hash ^= ch;
+      hash *= 1099511628211ull;
+    }
+    return hash;
+  }
+
 
 } // namespace strtool
 